@@ -0,0 +1,258 @@
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <iomanip>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#ifndef CPE2D_BENCHMARK_BUILD_TYPE
+#define CPE2D_BENCHMARK_BUILD_TYPE ""
+#endif
+
+namespace CitadelPhysicsEngine2D
+{
+namespace Bench
+{
+
+namespace
+{
+
+double Median(std::vector<double> values)
+{
+    std::sort(values.begin(), values.end());
+    const size_t mid = values.size() / 2;
+    if (values.size() % 2 == 1)
+        return values[mid];
+    return 0.5 * (values[mid - 1] + values[mid]);
+}
+
+// JSON 문자열 (이름에는 제어 문자가 없으므로 따옴표와 역슬래시만 처리)
+void WriteString(std::ostream& out, const std::string& value)
+{
+    out << '"';
+    for (char c : value)
+    {
+        if (c == '"' || c == '\\')
+            out << '\\';
+        out << c;
+    }
+    out << '"';
+}
+
+} // namespace
+
+const char* GetSimdLevelName(SimdLevel level)
+{
+    switch (level)
+    {
+    case SimdLevel::AVX2:
+        return "avx2";
+    case SimdLevel::SSE2:
+        return "sse2";
+    default:
+        return "scalar";
+    }
+}
+
+/**
+ * @brief 쓸 수 있는 가장 정확한 사이클 카운터를 고릅니다.
+ *
+ * perf_event 는 컨테이너나 perf_event_paranoid 설정에 따라 막혀 있을 수
+ * 있으므로 열어서 한 번 읽어 본 뒤 실패하면 rdtsc 로 넘어갑니다.
+ */
+CycleCounter::CycleCounter()
+{
+#if defined(__linux__)
+    perf_event_attr attr = {};
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_CPU_CYCLES;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    const long fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    if (fd >= 0)
+    {
+        m_PerfFd = static_cast<int>(fd);
+        uint64_t value = 0;
+        if (read(m_PerfFd, &value, sizeof(value)) == sizeof(value))
+        {
+            m_Source = Source::PerfEvent;
+            return;
+        }
+        close(m_PerfFd);
+        m_PerfFd = -1;
+    }
+#endif
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+    m_Source = Source::Rdtsc;
+#endif
+}
+
+CycleCounter::~CycleCounter()
+{
+#if defined(__linux__)
+    if (m_PerfFd >= 0)
+        close(m_PerfFd);
+#endif
+}
+
+const char* CycleCounter::GetSourceName() const
+{
+    switch (m_Source)
+    {
+    case Source::PerfEvent:
+        return "perf_event";
+    case Source::Rdtsc:
+        return "rdtsc";
+    default:
+        return "none";
+    }
+}
+
+uint64_t CycleCounter::Read() const
+{
+    switch (m_Source)
+    {
+#if defined(__linux__)
+    case Source::PerfEvent:
+    {
+        uint64_t value = 0;
+        if (read(m_PerfFd, &value, sizeof(value)) != sizeof(value))
+            return 0;
+        return value;
+    }
+#endif
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+    case Source::Rdtsc:
+        return __rdtsc();
+#endif
+    default:
+        return 0;
+    }
+}
+
+BenchmarkRunner::BenchmarkRunner(const BenchmarkOptions& options)
+    : m_Options(options)
+{
+    if (m_Options.repetitions == 0)
+        m_Options.repetitions = 1;
+}
+
+bool BenchmarkRunner::IsEnabled(const std::string& group,
+                                const std::string& name) const
+{
+    if (m_Options.filter.empty())
+        return true;
+    return (group + "/" + name).find(m_Options.filter) != std::string::npos;
+}
+
+void BenchmarkRunner::Record(BenchmarkResult result,
+                             std::vector<double>& nsPerCall,
+                             std::vector<double>& cyclesPerCall)
+{
+    const double ops = double(result.opsPerCall);
+    const double callNs = Median(nsPerCall);
+    result.nsPerOp = callNs / ops;
+    result.opsPerSecond = ops * 1e9 / callNs;
+    result.pairsPerSecond = double(result.pairsPerCall) * 1e9 / callNs;
+    if (m_Cycles.IsAvailable())
+        result.cyclesPerOp = Median(cyclesPerCall) / ops;
+
+    // 진행 표시 (JSON 을 표준 출력으로 보낼 수 있으므로 stderr)
+    std::fprintf(stderr, "  %-12s %-40s n=%-6u %10.2f ns/op\n",
+                 result.group.c_str(), result.name.c_str(), result.n,
+                 result.nsPerOp);
+    std::fflush(stderr);
+    m_Results.push_back(std::move(result));
+}
+
+void BenchmarkRunner::PrintTable(std::ostream& out) const
+{
+    out << std::left << std::setw(12) << "group" << std::setw(42) << "name"
+        << std::right << std::setw(7) << "n" << std::setw(12) << "ns/op"
+        << std::setw(14) << "Mpairs/s" << std::setw(12) << "cycles/op"
+        << '\n';
+    for (const BenchmarkResult& r : m_Results)
+    {
+        out << std::left << std::setw(12) << r.group << std::setw(42)
+            << r.name << std::right << std::setw(7) << r.n << std::fixed
+            << std::setprecision(2) << std::setw(12) << r.nsPerOp
+            << std::setw(14) << r.pairsPerSecond / 1e6 << std::setw(12);
+        if (r.cyclesPerOp >= 0.0)
+            out << r.cyclesPerOp;
+        else
+            out << "-";
+        out << '\n';
+    }
+    out << std::defaultfloat;
+}
+
+/**
+ * @brief 결과를 버전 간 비교용 JSON 으로 씁니다.
+ *
+ * 빌드 설정(SIMD 경로, 결정적 모드, 빌드 타입)을 함께 기록하므로 서로 다른
+ * 빌드의 결과를 섞어 비교하는 실수를 막을 수 있습니다.
+ */
+void BenchmarkRunner::WriteJson(std::ostream& out,
+                                uint32_t threadCount) const
+{
+    out << "{\n";
+    out << "  \"schema\": 1,\n";
+    out << "  \"build\": {\n";
+    out << "    \"type\": ";
+    WriteString(out, CPE2D_BENCHMARK_BUILD_TYPE);
+    out << ",\n    \"simd\": \"" << GetSimdLevelName(MaxSimdLevel()) << "\",\n";
+#if defined(CPE2D_DETERMINISTIC)
+    out << "    \"deterministic\": true,\n";
+#else
+    out << "    \"deterministic\": false,\n";
+#endif
+#if defined(__VERSION__)
+    out << "    \"compiler\": ";
+    WriteString(out, __VERSION__);
+    out << "\n";
+#else
+    out << "    \"compiler\": \"\"\n";
+#endif
+    out << "  },\n";
+    out << "  \"cycle_source\": \"" << m_Cycles.GetSourceName() << "\",\n";
+    out << "  \"threads\": " << threadCount << ",\n";
+    out << "  \"min_time_ms\": " << m_Options.minTimeMs << ",\n";
+    out << "  \"repetitions\": " << m_Options.repetitions << ",\n";
+    out << "  \"results\": [";
+    for (size_t i = 0; i < m_Results.size(); ++i)
+    {
+        const BenchmarkResult& r = m_Results[i];
+        out << (i == 0 ? "\n" : ",\n") << "    {\"group\": ";
+        WriteString(out, r.group);
+        out << ", \"name\": ";
+        WriteString(out, r.name);
+        out << ", \"n\": " << r.n << ", \"ops_per_call\": " << r.opsPerCall
+            << ", \"pairs_per_call\": " << r.pairsPerCall
+            << ", \"iterations\": " << r.iterations << std::setprecision(6)
+            << ", \"ns_per_op\": " << r.nsPerOp
+            << ", \"ops_per_sec\": " << r.opsPerSecond
+            << ", \"pairs_per_sec\": " << r.pairsPerSecond
+            << ", \"cycles_per_op\": ";
+        if (r.cyclesPerOp >= 0.0)
+            out << r.cyclesPerOp;
+        else
+            out << "null";
+        out << "}";
+    }
+    out << "\n  ]\n}\n";
+}
+
+} // namespace Bench
+} // namespace CitadelPhysicsEngine2D
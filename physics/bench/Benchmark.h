@@ -0,0 +1,204 @@
+#pragma once
+
+#include <CitadelPhysicsEngine2D/math/Simd.h>
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace CitadelPhysicsEngine2D
+{
+namespace Bench
+{
+
+// 컴파일러가 결과를 쓰지 않는 계산을 지우지 못하게 합니다.
+template <typename T>
+inline void DoNotOptimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+// "scalar", "sse2", "avx2" (결과 이름과 JSON 에 씀)
+const char* GetSimdLevelName(SimdLevel level);
+
+// 실행마다 같은 장면을 만들기 위한 고정 시드 난수 (xorshift32)
+class Random
+{
+public:
+    explicit Random(uint32_t seed) : m_State(seed != 0 ? seed : 1u) {}
+
+    uint32_t NextUInt()
+    {
+        m_State ^= m_State << 13;
+        m_State ^= m_State >> 17;
+        m_State ^= m_State << 5;
+        return m_State;
+    }
+    // [min, max)
+    float Range(float min, float max)
+    {
+        const float unit = float(NextUInt() >> 8) * (1.0f / 16777216.0f);
+        return min + (max - min) * unit;
+    }
+
+private:
+    uint32_t m_State;
+};
+
+// CPU 사이클 카운터
+// Linux 에서는 perf_event 의 사용자 모드 코어 사이클을, 안 되면 x86 의
+// rdtsc(기준 클럭 사이클, 터보와 무관)를 씁니다. 둘 다 없으면 0 입니다.
+class CycleCounter
+{
+public:
+    CycleCounter();
+    ~CycleCounter();
+
+    CycleCounter(const CycleCounter&) = delete;
+    CycleCounter& operator=(const CycleCounter&) = delete;
+
+    bool IsAvailable() const { return m_Source != Source::None; }
+    // "perf_event", "rdtsc", "none"
+    const char* GetSourceName() const;
+
+    uint64_t Read() const;
+
+private:
+    enum class Source
+    {
+        None,
+        PerfEvent,
+        Rdtsc,
+    };
+
+    Source m_Source = Source::None;
+    int m_PerfFd = -1;
+};
+
+struct BenchmarkOptions
+{
+    double minTimeMs = 50.0;   // 한 번 측정하는 최소 시간
+    uint32_t repetitions = 5;  // 측정 횟수 (중앙값 보고)
+    std::string filter;        // 이름에 이 문자열이 있는 벤치마크만 실행
+    std::vector<uint32_t> sizes = {256, 1024, 4096, 16384};
+};
+
+// 한 벤치마크의 한 크기에 대한 결과
+// op 는 벤치마크마다 정한 단위 연산(쌍 판정 하나, 질의 하나, 스텝 하나)이고,
+// pairs 는 판정한 쌍 수(커널) 또는 찾은 쌍 수(broadphase)입니다.
+struct BenchmarkResult
+{
+    std::string group;
+    std::string name;
+    uint32_t n = 0;
+    uint64_t opsPerCall = 0;
+    uint64_t pairsPerCall = 0;
+    uint64_t iterations = 0; // 측정 한 번의 호출 수
+    double nsPerOp = 0.0;
+    double opsPerSecond = 0.0;
+    double pairsPerSecond = 0.0;
+    double cyclesPerOp = -1.0; // 사이클 카운터가 없으면 -1
+};
+
+// 벤치마크 실행기
+// body() 한 번이 opsPerCall 개의 연산을 하도록 만들고 Run 에 넘기면,
+// minTime 을 넘길 때까지 호출 수를 늘려 측정한 뒤 repetitions 번 중
+// 중앙값을 기록합니다.
+class BenchmarkRunner
+{
+public:
+    explicit BenchmarkRunner(const BenchmarkOptions& options);
+
+    const BenchmarkOptions& GetOptions() const { return m_Options; }
+    bool IsEnabled(const std::string& group, const std::string& name) const;
+
+    template <typename Body>
+    void Run(const std::string& group, const std::string& name, uint32_t n,
+             uint64_t opsPerCall, uint64_t pairsPerCall, Body&& body);
+
+    const std::vector<BenchmarkResult>& GetResults() const
+    {
+        return m_Results;
+    }
+
+    void PrintTable(std::ostream& out) const;
+    void WriteJson(std::ostream& out, uint32_t threadCount) const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    void Record(BenchmarkResult result, std::vector<double>& nsPerCall,
+                std::vector<double>& cyclesPerCall);
+
+private:
+    BenchmarkOptions m_Options;
+    CycleCounter m_Cycles;
+    std::vector<BenchmarkResult> m_Results;
+};
+
+template <typename Body>
+void BenchmarkRunner::Run(const std::string& group, const std::string& name,
+                          uint32_t n, uint64_t opsPerCall,
+                          uint64_t pairsPerCall, Body&& body)
+{
+    if (IsEnabled(group, name) == false)
+        return;
+
+    // 캐시와 분기 예측을 데우고 호출 수를 맞춥니다.
+    body();
+    uint64_t iterations = 1;
+    const double minTimeNs = m_Options.minTimeMs * 1e6;
+    for (;;)
+    {
+        const Clock::time_point start = Clock::now();
+        for (uint64_t i = 0; i < iterations; ++i)
+            body();
+        const double elapsed = std::chrono::duration<double, std::nano>(
+                                   Clock::now() - start)
+                                   .count();
+        if (elapsed >= minTimeNs || iterations >= (uint64_t(1) << 40))
+            break;
+        // 목표 시간의 1.2 배를 노리되 한 번에 10 배 이상 늘리지 않음
+        const double scale = elapsed > 0.0 ? minTimeNs * 1.2 / elapsed : 10.0;
+        iterations = static_cast<uint64_t>(
+            iterations * (scale < 10.0 ? scale : 10.0) + 1.0);
+    }
+
+    std::vector<double> nsPerCall;
+    std::vector<double> cyclesPerCall;
+    for (uint32_t r = 0; r < m_Options.repetitions; ++r)
+    {
+        const uint64_t cycleStart = m_Cycles.Read();
+        const Clock::time_point start = Clock::now();
+        for (uint64_t i = 0; i < iterations; ++i)
+            body();
+        const Clock::time_point end = Clock::now();
+        const uint64_t cycleEnd = m_Cycles.Read();
+
+        nsPerCall.push_back(
+            std::chrono::duration<double, std::nano>(end - start).count() /
+            double(iterations));
+        cyclesPerCall.push_back(double(cycleEnd - cycleStart) /
+                                double(iterations));
+    }
+
+    BenchmarkResult result;
+    result.group = group;
+    result.name = name;
+    result.n = n;
+    result.opsPerCall = opsPerCall;
+    result.pairsPerCall = pairsPerCall;
+    result.iterations = iterations;
+    Record(std::move(result), nsPerCall, cyclesPerCall);
+}
+
+} // namespace Bench
+} // namespace CitadelPhysicsEngine2D
@@ -0,0 +1,755 @@
+#include "Benchmark.h"
+#include "StressScenes.h"
+
+#include <CitadelPhysicsEngine2D/core.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <thread>
+
+using namespace CitadelPhysicsEngine2D;
+using namespace CitadelPhysicsEngine2D::Bench;
+
+namespace
+{
+
+// 벤치마크는 Release 로 빌드하므로 준비 단계의 검사는 assert 대신 직접
+// 확인하고, 틀리면 엉뚱한 수치를 내지 않도록 바로 끝냅니다.
+void Require(bool condition, const char* message)
+{
+    if (condition)
+        return;
+    std::cerr << "benchmark setup check failed: " << message << '\n';
+    std::exit(EXIT_FAILURE);
+}
+
+// 물체 하나당 이웃 수가 n 과 관계없이 비슷하도록 n 에 맞춰 넓힌 정사각형 영역
+float SceneExtent(uint32_t n)
+{
+    return std::sqrt(float(n)) * 1.5f;
+}
+
+std::vector<AABB> MakeBoxes(uint32_t n, uint32_t seed)
+{
+    Random random(seed);
+    const float extent = SceneExtent(n);
+    std::vector<AABB> boxes(n);
+    for (AABB& box : boxes)
+    {
+        const glm::vec2 center(random.Range(0.0f, extent),
+                               random.Range(0.0f, extent));
+        const glm::vec2 half(random.Range(0.25f, 0.75f),
+                             random.Range(0.25f, 0.75f));
+        box = AABB(center - half, center + half);
+    }
+    return boxes;
+}
+
+std::vector<Circle> MakeCircles(uint32_t n, uint32_t seed)
+{
+    Random random(seed);
+    const float extent = SceneExtent(n);
+    std::vector<Circle> circles(n);
+    for (Circle& circle : circles)
+    {
+        circle = Circle(random.Range(0.25f, 0.75f),
+                        {random.Range(0.0f, extent),
+                         random.Range(0.0f, extent)});
+    }
+    return circles;
+}
+
+// 중심 거리가 [0, 2) 인 도형 쌍 (대략 절반이 충돌)
+std::vector<glm::vec2> MakePairOffsets(uint32_t n, uint32_t seed)
+{
+    Random random(seed);
+    std::vector<glm::vec2> offsets(n);
+    for (glm::vec2& offset : offsets)
+    {
+        const float angle = random.Range(0.0f, 6.2831853f);
+        const float distance = random.Range(0.0f, 2.0f);
+        offset = {std::cos(angle) * distance, std::sin(angle) * distance};
+    }
+    return offsets;
+}
+
+std::vector<SimdLevel> GetSimdLevels()
+{
+    std::vector<SimdLevel> levels = {SimdLevel::Scalar};
+    if (MaxSimdLevel() >= SimdLevel::SSE2)
+        levels.push_back(SimdLevel::SSE2);
+    if (MaxSimdLevel() >= SimdLevel::AVX2)
+        levels.push_back(SimdLevel::AVX2);
+    return levels;
+}
+
+std::string WithLevel(const char* name, SimdLevel level)
+{
+    return std::string(name) + "/" + GetSimdLevelName(level);
+}
+
+// 모든 쌍을 검사하는 O(n^2) 벤치마크는 이 크기까지만 돌립니다.
+constexpr uint32_t MaxBruteForceCount = 4096;
+// 배치 질의 벤치마크 한 번에 던지는 질의 수
+constexpr uint32_t QueriesPerCall = 64;
+
+// --- 도형 판정 ---
+
+void RunShapeBenchmarks(BenchmarkRunner& runner, uint32_t n)
+{
+    const std::vector<AABB> boxes = MakeBoxes(n, 1);
+    const std::vector<Circle> circles = MakeCircles(n, 2);
+    const std::vector<glm::vec2> offsets = MakePairOffsets(n, 3);
+
+    std::vector<AABB> otherBoxes(n);
+    std::vector<Circle> otherCircles(n);
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        otherBoxes[i] = AABB(boxes[i].min + offsets[i],
+                             boxes[i].max + offsets[i]);
+        otherCircles[i] = Circle(circles[i].radius,
+                                 circles[i].position + offsets[i]);
+    }
+
+    runner.Run("shapes", "AABBvsAABB", n, n, n, [&]() {
+        uint32_t separated = 0;
+        for (uint32_t i = 0; i < n; ++i)
+            separated += AABB::AABBvsAABB(boxes[i], otherBoxes[i]) ? 1 : 0;
+        DoNotOptimize(separated);
+    });
+
+    runner.Run("shapes", "CirclevsCircle", n, n, n, [&]() {
+        uint32_t separated = 0;
+        for (uint32_t i = 0; i < n; ++i)
+        {
+            separated +=
+                Circle::CirclevsCircle(circles[i], otherCircles[i]) ? 1 : 0;
+        }
+        DoNotOptimize(separated);
+    });
+}
+
+// --- narrowphase ---
+
+void RunNarrowphaseBenchmarks(BenchmarkRunner& runner, uint32_t n)
+{
+    const std::vector<AABB> boxes = MakeBoxes(n, 4);
+    const std::vector<Circle> circles = MakeCircles(n, 5);
+    const std::vector<glm::vec2> offsets = MakePairOffsets(n, 6);
+
+    // 인덱스 2i, 2i + 1 을 한 쌍으로 쓰는 SoA 와 pair 리스트
+    AABBSoA boxSoA;
+    CircleSoA circleSoA;
+    std::vector<OverlapPair> pairs(n);
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        boxSoA.Add(boxes[i]);
+        boxSoA.Add(AABB(boxes[i].min + offsets[i], boxes[i].max + offsets[i]));
+        circleSoA.Add(circles[i]);
+        circleSoA.Add(Circle(circles[i].radius,
+                             circles[i].position + offsets[i]));
+        pairs[i] = {2 * i, 2 * i + 1};
+    }
+    std::vector<ContactManifold> manifolds(n);
+
+    runner.Run("narrowphase", "CollideCircles", n, n, n, [&]() {
+        uint32_t hits = 0;
+        for (uint32_t i = 0; i < n; ++i)
+        {
+            hits += CollideCircles(circleSoA.Get(2 * i),
+                                   circleSoA.Get(2 * i + 1), manifolds[i])
+                        ? 1
+                        : 0;
+        }
+        DoNotOptimize(hits);
+    });
+
+    runner.Run("narrowphase", "CollideAABBs", n, n, n, [&]() {
+        uint32_t hits = 0;
+        for (uint32_t i = 0; i < n; ++i)
+        {
+            hits += CollideAABBs(boxSoA.Get(2 * i), boxSoA.Get(2 * i + 1),
+                                 manifolds[i])
+                        ? 1
+                        : 0;
+        }
+        DoNotOptimize(hits);
+    });
+
+    runner.Run("narrowphase", "CollideCircleAABB", n, n, n, [&]() {
+        uint32_t hits = 0;
+        for (uint32_t i = 0; i < n; ++i)
+        {
+            hits += CollideCircleAABB(circleSoA.Get(2 * i),
+                                      boxSoA.Get(2 * i + 1), manifolds[i])
+                        ? 1
+                        : 0;
+        }
+        DoNotOptimize(hits);
+    });
+
+    runner.Run("narrowphase", "CollideCirclesBatch", n, n, n, [&]() {
+        DoNotOptimize(CollideCirclesBatch(circleSoA, pairs.data(), n,
+                                          manifolds.data()));
+    });
+
+    runner.Run("narrowphase", "CollideAABBsBatch", n, n, n, [&]() {
+        DoNotOptimize(
+            CollideAABBsBatch(boxSoA, pairs.data(), n, manifolds.data()));
+    });
+
+    runner.Run("narrowphase", "CollideCircleAABBBatch", n, n, n, [&]() {
+        DoNotOptimize(CollideCircleAABBBatch(circleSoA, boxSoA, pairs.data(),
+                                             n, manifolds.data()));
+    });
+
+    // 회전된 상자 쌍: SAT (캐시 없음 / 있음) 와 GJK + EPA
+    Random random(7);
+    std::vector<OBB> obbs(2 * n);
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        const glm::vec2 center = 0.5f * (boxes[i].min + boxes[i].max);
+        const glm::vec2 half = 0.5f * (boxes[i].max - boxes[i].min);
+        obbs[2 * i] = OBB(center, half, random.Range(0.0f, 3.1415927f));
+        obbs[2 * i + 1] = OBB(center + offsets[i], half,
+                              random.Range(0.0f, 3.1415927f));
+    }
+    std::vector<Polygon> polygons(2 * n);
+    std::vector<Transform2D> transforms(2 * n);
+    std::vector<ConvexProxy> proxies(2 * n);
+    for (uint32_t i = 0; i < 2 * n; ++i)
+    {
+        polygons[i] = obbs[i].GetPolygon();
+        transforms[i] = obbs[i].GetTransform();
+        proxies[i] = ConvexProxy::FromOBB(obbs[i]);
+    }
+
+    runner.Run("narrowphase", "CollidePolygons", n, n, n, [&]() {
+        uint32_t hits = 0;
+        for (uint32_t i = 0; i < n; ++i)
+        {
+            hits += CollidePolygons(polygons[2 * i], transforms[2 * i],
+                                    polygons[2 * i + 1],
+                                    transforms[2 * i + 1], manifolds[i])
+                        ? 1
+                        : 0;
+        }
+        DoNotOptimize(hits);
+    });
+
+    // 정지한 쌍이므로 첫 호출 뒤에는 캐시된 축이 항상 맞는 최선의 경우
+    std::vector<SATCache> satCaches(n);
+    runner.Run("narrowphase", "CollidePolygons/cached", n, n, n, [&]() {
+        uint32_t hits = 0;
+        for (uint32_t i = 0; i < n; ++i)
+        {
+            hits += CollidePolygons(polygons[2 * i], transforms[2 * i],
+                                    polygons[2 * i + 1],
+                                    transforms[2 * i + 1], manifolds[i],
+                                    &satCaches[i])
+                        ? 1
+                        : 0;
+        }
+        DoNotOptimize(hits);
+    });
+
+    runner.Run("narrowphase", "GJKCollide", n, n, n, [&]() {
+        uint32_t hits = 0;
+        for (uint32_t i = 0; i < n; ++i)
+        {
+            hits += GJKCollide(proxies[2 * i], proxies[2 * i + 1],
+                               manifolds[i])
+                        ? 1
+                        : 0;
+        }
+        DoNotOptimize(hits);
+    });
+
+    std::vector<SimplexCache> simplexCaches(n);
+    runner.Run("narrowphase", "GJKCollide/cached", n, n, n, [&]() {
+        uint32_t hits = 0;
+        for (uint32_t i = 0; i < n; ++i)
+        {
+            hits += GJKCollide(proxies[2 * i], proxies[2 * i + 1],
+                               manifolds[i], &simplexCaches[i])
+                        ? 1
+                        : 0;
+        }
+        DoNotOptimize(hits);
+    });
+}
+
+// --- SoA 배치 질의 (SIMD 경로별) ---
+
+void RunBatchBenchmarks(BenchmarkRunner& runner, uint32_t n)
+{
+    const std::vector<AABB> boxes = MakeBoxes(n, 8);
+    const std::vector<Circle> circles = MakeCircles(n, 9);
+    const std::vector<AABB> boxQueries = MakeBoxes(QueriesPerCall, 10);
+    const std::vector<Circle> circleQueries = MakeCircles(QueriesPerCall, 11);
+
+    AABBSoA boxSoA;
+    CircleSoA circleSoA;
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        boxSoA.Add(boxes[i]);
+        circleSoA.Add(circles[i]);
+    }
+    // 질의를 장면 전체에 흩어 놓기 위해 장면 크기로 늘림
+    const float scale = SceneExtent(n) / SceneExtent(QueriesPerCall);
+    std::vector<AABB> scaledBoxQueries(QueriesPerCall);
+    std::vector<Circle> scaledCircleQueries(QueriesPerCall);
+    for (uint32_t q = 0; q < QueriesPerCall; ++q)
+    {
+        const glm::vec2 shift =
+            0.5f * (boxQueries[q].min + boxQueries[q].max) * (scale - 1.0f);
+        scaledBoxQueries[q] =
+            AABB(boxQueries[q].min + shift, boxQueries[q].max + shift);
+        scaledCircleQueries[q] = Circle(circleQueries[q].radius,
+                                        circleQueries[q].position * scale);
+    }
+
+    std::vector<uint32_t> mask((n + 31) / 32);
+    std::vector<uint32_t> indices(n);
+    const uint64_t queryPairs = uint64_t(QueriesPerCall) * n;
+
+    for (SimdLevel level : GetSimdLevels())
+    {
+        runner.Run("batch", WithLevel("AABBSoA::QueryOverlapMask", level), n,
+                   QueriesPerCall, queryPairs, [&]() {
+                       uint32_t hits = 0;
+                       for (const AABB& query : scaledBoxQueries)
+                       {
+                           hits += boxSoA.QueryOverlapMask(
+                               query, mask.data(), level);
+                       }
+                       DoNotOptimize(hits);
+                   });
+
+        runner.Run("batch", WithLevel("AABBSoA::QueryOverlapIndices", level),
+                   n, QueriesPerCall, queryPairs, [&]() {
+                       uint32_t hits = 0;
+                       for (const AABB& query : scaledBoxQueries)
+                       {
+                           hits += boxSoA.QueryOverlapIndices(
+                               query, indices.data(), level);
+                       }
+                       DoNotOptimize(hits);
+                   });
+
+        runner.Run("batch",
+                   WithLevel("CircleSoA::QueryOverlapIndices", level), n,
+                   QueriesPerCall, queryPairs, [&]() {
+                       uint32_t hits = 0;
+                       for (const Circle& query : scaledCircleQueries)
+                       {
+                           hits += circleSoA.QueryOverlapIndices(
+                               query, indices.data(), level);
+                       }
+                       DoNotOptimize(hits);
+                   });
+    }
+
+    if (n > MaxBruteForceCount)
+        return;
+
+    // 모든 쌍 검사: op 하나 = 검사한 쌍 하나
+    const uint64_t allPairs = uint64_t(n) * (n - 1) / 2;
+    std::vector<OverlapPair> pairs;
+    std::vector<OverlapPair> tilePairs(n * 8);
+    for (SimdLevel level : GetSimdLevels())
+    {
+        runner.Run("batch",
+                   WithLevel("AABBSoA::QuerySelfOverlapPairs", level), n,
+                   allPairs, allPairs, [&]() {
+                       pairs.clear();
+                       boxSoA.QuerySelfOverlapPairs(pairs, level);
+                       DoNotOptimize(pairs.data());
+                   });
+
+        runner.Run("batch",
+                   WithLevel("CircleSoA::QueryTileOverlapPairs", level), n,
+                   allPairs, allPairs, [&]() {
+                       DoNotOptimize(circleSoA.QueryTileOverlapPairs(
+                           0, n, 0, n, tilePairs.data(),
+                           uint32_t(tilePairs.size()), level));
+                   });
+    }
+}
+
+// --- broadphase ---
+
+void RunBroadphaseBenchmarks(BenchmarkRunner& runner, uint32_t n,
+                             JobSystem& jobs)
+{
+    const std::vector<AABB> boxes = MakeBoxes(n, 12);
+    const std::vector<Circle> circles = MakeCircles(n, 13);
+    std::vector<OverlapPair> pairs;
+
+    // 매 호출 모든 상자를 조금씩 흔드는 프레임 간 갱신 (삽입 정렬 경로)
+    {
+        SweepAndPrune sap;
+        std::vector<uint32_t> proxies;
+        proxies.reserve(n);
+        for (const AABB& box : boxes)
+            proxies.push_back(sap.CreateProxy(box));
+        sap.UpdatePairs(pairs);
+
+        uint32_t frame = 0;
+        auto update = [&]() {
+            const float shift = (frame++ & 1) != 0 ? 0.02f : -0.02f;
+            for (uint32_t i = 0; i < n; ++i)
+            {
+                const glm::vec2 d(i % 3 == 0 ? shift : -shift, shift);
+                sap.MoveProxy(proxies[i],
+                              AABB(boxes[i].min + d, boxes[i].max + d));
+            }
+            pairs.clear();
+            sap.UpdatePairs(pairs);
+        };
+        update();
+        runner.Run("broadphase", "SweepAndPrune::UpdatePairs", n, 1,
+                   pairs.size(), update);
+    }
+
+    {
+        // 프록시 id 는 노드 인덱스라 내부 노드와 섞여 body 순서와 다름
+        DynamicTree tree;
+        std::vector<uint32_t> proxies;
+        proxies.reserve(n);
+        for (uint32_t i = 0; i < n; ++i)
+            proxies.push_back(tree.CreateProxy(boxes[i], i));
+        tree.QueryMovedPairs(pairs);
+
+        pairs.clear();
+        tree.QueryAllPairs(pairs);
+        runner.Run("broadphase", "DynamicTree::QueryAllPairs", n, 1,
+                   pairs.size(), [&]() {
+                       pairs.clear();
+                       tree.QueryAllPairs(pairs);
+                       DoNotOptimize(pairs.data());
+                   });
+
+        // 1/16 의 프록시가 fat AABB 를 벗어나 재삽입되는 프레임
+        uint32_t frame = 0;
+        auto moveAndQuery = [&]() {
+            const glm::vec2 d((frame++ & 1) != 0 ? 0.0f : 0.5f, 0.0f);
+            for (uint32_t i = 0; i < n; i += 16)
+            {
+                tree.MoveProxy(proxies[i],
+                               AABB(boxes[i].min + d, boxes[i].max + d));
+            }
+            pairs.clear();
+            tree.QueryMovedPairs(pairs);
+        };
+        moveAndQuery();
+        Require(tree.Validate(), "DynamicTree::Validate after warmup");
+        runner.Run("broadphase", "DynamicTree::QueryMovedPairs", n, 1,
+                   pairs.size(), moveAndQuery);
+    }
+
+    {
+        CircleSoA circleSoA;
+        for (const Circle& circle : circles)
+            circleSoA.Add(circle);
+        SpatialHashGrid grid(1.5f);
+        pairs.clear();
+        grid.FindPairs(circleSoA, pairs);
+        runner.Run("broadphase", "SpatialHashGrid::FindPairs", n, 1,
+                   pairs.size(), [&]() {
+                       pairs.clear();
+                       grid.FindPairs(circleSoA, pairs);
+                       DoNotOptimize(pairs.data());
+                   });
+    }
+
+    if (n > MaxBruteForceCount)
+        return;
+
+    {
+        AABBSoA boxSoA;
+        for (const AABB& box : boxes)
+            boxSoA.Add(box);
+        ParallelPairFinder finder(jobs);
+        const uint64_t allPairs = uint64_t(n) * (n - 1) / 2;
+        runner.Run("broadphase", "ParallelPairFinder::FindSelfPairs", n,
+                   allPairs, allPairs, [&]() {
+                       pairs.clear();
+                       finder.FindSelfPairs(boxSoA, pairs);
+                       DoNotOptimize(pairs.data());
+                   });
+    }
+}
+
+// --- CCD ---
+
+void RunCCDBenchmarks(BenchmarkRunner& runner, uint32_t n)
+{
+    // 모든 원이 bullet 이고 상자는 원의 1/4
+    const std::vector<Circle> circles = MakeCircles(n, 14);
+    const std::vector<AABB> boxes = MakeBoxes(n / 4 + 1, 15);
+    const std::vector<glm::vec2> offsets = MakePairOffsets(n, 16);
+
+    CircleSoA circleSoA;
+    AABBSoA boxSoA;
+    for (const Circle& circle : circles)
+        circleSoA.Add(circle);
+    const float scale = SceneExtent(n) / SceneExtent(n / 4 + 1);
+    for (const AABB& box : boxes)
+        boxSoA.Add(AABB(box.min * scale, box.max * scale));
+    std::vector<uint8_t> bullets(n, 1);
+
+    StackArena scratch;
+    std::vector<TOIEvent> events;
+    runner.Run("ccd", "FindTimeOfImpacts", n, n, n, [&]() {
+        events.clear();
+        DoNotOptimize(FindTimeOfImpacts(circleSoA, offsets.data(),
+                                        bullets.data(), boxSoA,
+                                        CCDSettings(), events, &scratch));
+        scratch.Reset();
+    });
+}
+
+// --- 솔버 / World ---
+
+void RunSolverBenchmarks(BenchmarkRunner& runner, uint32_t n,
+                         JobSystem& jobs)
+{
+    constexpr float TimeStep = 1.0f / 60.0f;
+
+    // 쌓인 상자 더미의 접촉으로 솔버만 따로 측정합니다.
+    {
+        World world;
+        world.SetSleepingEnabled(false);
+        const std::vector<BodyDef> defs =
+            BuildScene(world, {SceneType::Pyramids, n, 1});
+        for (uint32_t i = 0; i < 60; ++i)
+            world.Step(TimeStep);
+
+        const uint32_t count = world.GetBodyCount();
+        std::vector<float> velocityX(count), velocityY(count),
+            angularVelocity(count), positionX(count), positionY(count),
+            angle(count), invMass(count), invInertia(count),
+            friction(count), restitution(count);
+        std::vector<float> savedVelocityX(count), savedVelocityY(count),
+            savedAngularVelocity(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const BodyHandle handle = world.GetBodyHandle(i);
+            const glm::vec2 position = world.GetPosition(handle);
+            const glm::vec2 velocity = world.GetLinearVelocity(handle);
+            positionX[i] = position.x;
+            positionY[i] = position.y;
+            angle[i] = world.GetAngle(handle);
+            savedVelocityX[i] = velocity.x;
+            savedVelocityY[i] = velocity.y;
+            savedAngularVelocity[i] = world.GetAngularVelocity(handle);
+
+            // World::CreateBody 와 같은 질량 계산
+            const BodyDef& def = defs[i];
+            const glm::vec2 h = def.halfExtents;
+            const float mass = def.density * 4.0f * h.x * h.y;
+            const bool dynamic = def.type == BodyType::Dynamic;
+            invMass[i] = dynamic ? 1.0f / mass : 0.0f;
+            invInertia[i] =
+                dynamic ? 3.0f / (mass * (h.x * h.x + h.y * h.y)) : 0.0f;
+            friction[i] = def.friction;
+            restitution[i] = def.restitution;
+        }
+        const SolverBodies bodies = {
+            velocityX.data(),       velocityY.data(), angularVelocity.data(),
+            positionX.data(),       positionY.data(), angle.data(),
+            invMass.data(),         invInertia.data(), friction.data(),
+            restitution.data()};
+
+        const std::vector<ContactManifold>& contacts = world.GetContacts();
+        const uint32_t contactCount = uint32_t(contacts.size());
+        const uint32_t iterations = world.GetVelocityIterations();
+
+        // op 하나 = 접촉 하나의 Prepare + WarmStart + 속도 반복 전체
+        auto solve = [&](ContactSolver& solver) {
+            std::copy(savedVelocityX.begin(), savedVelocityX.end(),
+                      velocityX.begin());
+            std::copy(savedVelocityY.begin(), savedVelocityY.end(),
+                      velocityY.begin());
+            std::copy(savedAngularVelocity.begin(),
+                      savedAngularVelocity.end(), angularVelocity.begin());
+            solver.Prepare(contacts.data(), contactCount, bodies,
+                           &world.GetContactCache());
+            solver.WarmStart(bodies);
+            for (uint32_t i = 0; i < iterations; ++i)
+                solver.SolveVelocities(bodies);
+            solver.StoreImpulses();
+            DoNotOptimize(velocityX.data());
+        };
+
+        for (SimdLevel level : GetSimdLevels())
+        {
+            ContactSolver solver;
+            solver.SetSimdLevel(level);
+            runner.Run("solver", WithLevel("ContactSolver", level), n,
+                       contactCount, contactCount,
+                       [&]() { solve(solver); });
+        }
+        if (jobs.GetThreadCount() > 1)
+        {
+            ContactSolver solver;
+            solver.SetJobSystem(&jobs);
+            runner.Run("solver", "ContactSolver/jobs", n, contactCount,
+                       contactCount, [&]() { solve(solver); });
+        }
+    }
+
+    // 한쪽 끝을 고정한 로프: op 하나 = 입자 하나의 스텝
+    {
+        ParticleSystem particles;
+        particles.Reserve(n);
+        ParticleDef def;
+        def.mass = 0.0f;
+        uint32_t previous = particles.CreateParticle(def);
+        def.mass = 1.0f;
+        for (uint32_t i = 1; i < n; ++i)
+        {
+            def.position = {float(i) * 0.1f, 0.0f};
+            const uint32_t next = particles.CreateParticle(def);
+            particles.AddDistanceConstraint(previous, next);
+            previous = next;
+        }
+        particles.AddCollider(AABB({-1e4f, -1e4f}, {1e4f, -50.0f}));
+        runner.Run("solver", "ParticleSystem::Step", n, n, n,
+                   [&]() { particles.Step(TimeStep); });
+    }
+}
+
+void RunWorldBenchmarks(BenchmarkRunner& runner, uint32_t n, JobSystem& jobs)
+{
+    constexpr float TimeStep = 1.0f / 60.0f;
+
+    // 잠들면 스텝이 비므로 잠들기를 끄고 흔들리는 더미를 계속 풉니다.
+    for (int parallel = 0; parallel < 2; ++parallel)
+    {
+        if (parallel != 0 && jobs.GetThreadCount() == 1)
+            break;
+
+        World world;
+        world.SetSleepingEnabled(false);
+        BuildScene(world, {SceneType::Pyramids, n, 1});
+        if (parallel != 0)
+            world.SetJobSystem(&jobs);
+        for (uint32_t i = 0; i < 30; ++i)
+            world.Step(TimeStep);
+
+        runner.Run("world", parallel != 0 ? "Step/jobs" : "Step", n, 1,
+                   world.GetContacts().size(),
+                   [&]() { world.Step(TimeStep); });
+    }
+}
+
+void PrintUsage(const char* program)
+{
+    std::cout
+        << "usage: " << program << " [options]\n"
+        << "  --filter <text>     group/name 에 text 가 있는 벤치마크만 실행\n"
+        << "  --sizes <a,b,...>   물체 수 목록 (기본 256,1024,4096,16384)\n"
+        << "  --min-time <ms>     측정 한 번의 최소 시간 (기본 50)\n"
+        << "  --repetitions <n>   측정 횟수, 중앙값 보고 (기본 5)\n"
+        << "  --threads <n>       JobSystem 스레드 수 (기본 하드웨어)\n"
+        << "  --json <path|->     결과 JSON 을 파일 또는 표준 출력으로\n";
+}
+
+bool ParseSizes(const char* text, std::vector<uint32_t>& outSizes)
+{
+    outSizes.clear();
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ','))
+    {
+        const long value = std::strtol(item.c_str(), nullptr, 10);
+        if (value <= 1)
+            return false;
+        outSizes.push_back(uint32_t(value));
+    }
+    return outSizes.empty() == false;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    BenchmarkOptions options;
+    uint32_t threadCount = 0;
+    std::string jsonPath;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        bool valid = value != nullptr;
+        if (std::strcmp(arg, "--filter") == 0 && valid)
+            options.filter = value;
+        else if (std::strcmp(arg, "--sizes") == 0 && valid)
+            valid = ParseSizes(value, options.sizes);
+        else if (std::strcmp(arg, "--min-time") == 0 && valid)
+            options.minTimeMs = std::atof(value);
+        else if (std::strcmp(arg, "--repetitions") == 0 && valid)
+            options.repetitions = uint32_t(std::atoi(value));
+        else if (std::strcmp(arg, "--threads") == 0 && valid)
+            threadCount = uint32_t(std::atoi(value));
+        else if (std::strcmp(arg, "--json") == 0 && valid)
+            jsonPath = value;
+        else
+            valid = false;
+
+        if (valid == false)
+        {
+            PrintUsage(argv[0]);
+            return std::strcmp(arg, "--help") == 0 ? 0 : 1;
+        }
+        ++i;
+    }
+
+    BenchmarkRunner runner(options);
+    JobSystem jobs(threadCount);
+
+    // JSON 을 표준 출력으로 보낼 때는 진행 표시를 섞지 않도록 stderr 로
+    std::ostream& log = jsonPath == "-" ? std::cerr : std::cout;
+    log << "CitadelPhysicsEngine2D benchmark (simd "
+        << GetSimdLevelName(MaxSimdLevel()) << ", threads "
+        << jobs.GetThreadCount() << ")\n";
+
+    for (uint32_t n : options.sizes)
+    {
+        RunShapeBenchmarks(runner, n);
+        RunNarrowphaseBenchmarks(runner, n);
+        RunBatchBenchmarks(runner, n);
+        RunBroadphaseBenchmarks(runner, n, jobs);
+        RunCCDBenchmarks(runner, n);
+        RunSolverBenchmarks(runner, n, jobs);
+        RunWorldBenchmarks(runner, n, jobs);
+    }
+
+    log << '\n';
+    runner.PrintTable(log);
+
+    if (jsonPath == "-")
+    {
+        runner.WriteJson(std::cout, jobs.GetThreadCount());
+    }
+    else if (jsonPath.empty() == false)
+    {
+        std::ofstream file(jsonPath);
+        if (file.is_open() == false)
+        {
+            std::cerr << "cannot open " << jsonPath << '\n';
+            return 1;
+        }
+        runner.WriteJson(file, jobs.GetThreadCount());
+    }
+    return 0;
+}
@@ -0,0 +1,434 @@
+#include "Benchmark.h"
+#include "StressScenes.h"
+
+#include <CitadelPhysicsEngine2D/core.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/resource.h>
+#endif
+
+using namespace CitadelPhysicsEngine2D;
+using namespace CitadelPhysicsEngine2D::Bench;
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+constexpr float TimeStep = 1.0f / 60.0f;
+
+// 모든 쌍을 검사하는 broadphase 비교는 이 body 수까지만 돌립니다.
+constexpr uint32_t MaxBruteForceCount = 8192;
+
+struct StressOptions
+{
+    std::vector<SceneType> scenes;
+    uint32_t bodyCount = 2048;
+    uint32_t frames = 600;
+    uint32_t seed = 1;
+    std::vector<uint32_t> threadCounts = {1}; // 1 = JobSystem 없음
+    bool sleeping = true;
+    bool compareBroadphase = false;
+};
+
+struct StageInfo
+{
+    const char* name;
+    float StepProfile::*field;
+};
+
+const StageInfo Stages[] = {
+    {"integrate velocities", &StepProfile::integrateVelocities},
+    {"broadphase", &StepProfile::broadphase},
+    {"collide", &StepProfile::collide},
+    {"solve velocities", &StepProfile::solveVelocities},
+    {"continuous", &StepProfile::continuous},
+    {"integrate positions", &StepProfile::integratePositions},
+    {"solve positions", &StepProfile::solvePositions},
+    {"sleep", &StepProfile::sleep},
+    {"step", &StepProfile::step},
+};
+constexpr size_t StageCount = sizeof(Stages) / sizeof(Stages[0]);
+
+double ElapsedMs(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start)
+        .count();
+}
+
+// 프로세스 최대 상주 메모리 (KiB, 알 수 없으면 0)
+uint64_t GetPeakResidentKiB()
+{
+#if defined(__linux__)
+    rusage usage = {};
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+        return uint64_t(usage.ru_maxrss);
+#endif
+    return 0;
+}
+
+// 장면의 동적 body 를 매 프레임 독립된 broadphase 들에 넣어 모든 겹침 쌍을
+// 찾는 비용을 비교합니다. 정적 body(바닥 / 벽)는 격자 셀 크기를 망가뜨리므로
+// 빼고, 격자는 상자를 외접원으로 다룹니다. 트리는 fat AABB 를 쓰므로 찾는
+// 쌍 수가 조금씩 다릅니다.
+class BroadphaseComparison
+{
+public:
+    explicit BroadphaseComparison(const std::vector<BodyDef>& defs)
+        : m_Defs(defs)
+    {
+        for (uint32_t i = 0; i < uint32_t(defs.size()); ++i)
+        {
+            if (defs[i].type == BodyType::Dynamic)
+                m_Dynamic.push_back(i);
+        }
+        m_Boxes.resize(m_Dynamic.size());
+        m_Circles.resize(m_Dynamic.size());
+    }
+
+    void Update(const World& world)
+    {
+        const uint32_t n = uint32_t(m_Dynamic.size());
+        for (uint32_t i = 0; i < n; ++i)
+        {
+            const uint32_t body = m_Dynamic[i];
+            const BodyDef& def = m_Defs[body];
+            const Transform2D xf =
+                world.GetTransform(world.GetBodyHandle(body));
+            glm::vec2 extent;
+            float radius;
+            if (def.shape == ShapeType::Circle)
+            {
+                extent = {def.radius, def.radius};
+                radius = def.radius;
+            }
+            else
+            {
+                const float c = std::abs(xf.rotation.x);
+                const float s = std::abs(xf.rotation.y);
+                const glm::vec2 h = def.halfExtents;
+                extent = {c * h.x + s * h.y, s * h.x + c * h.y};
+                radius = std::sqrt(h.x * h.x + h.y * h.y);
+            }
+            m_Boxes[i] = AABB(xf.position - extent, xf.position + extent);
+            m_Circles[i] = Circle(radius, xf.position);
+        }
+
+        Clock::time_point start = Clock::now();
+        if (m_TreeProxies.empty())
+        {
+            for (uint32_t i = 0; i < n; ++i)
+                m_TreeProxies.push_back(m_Tree.CreateProxy(m_Boxes[i], i));
+        }
+        else
+        {
+            for (uint32_t i = 0; i < n; ++i)
+                m_Tree.MoveProxy(m_TreeProxies[i], m_Boxes[i]);
+        }
+        m_Pairs.clear();
+        m_Tree.QueryAllPairs(m_Pairs);
+        Record(m_Results[0], start);
+
+        start = Clock::now();
+        if (m_SAPProxies.empty())
+        {
+            for (uint32_t i = 0; i < n; ++i)
+                m_SAPProxies.push_back(m_SAP.CreateProxy(m_Boxes[i]));
+        }
+        else
+        {
+            for (uint32_t i = 0; i < n; ++i)
+                m_SAP.MoveProxy(m_SAPProxies[i], m_Boxes[i]);
+        }
+        m_Pairs.clear();
+        m_SAP.UpdatePairs(m_Pairs);
+        Record(m_Results[1], start);
+
+        start = Clock::now();
+        m_Pairs.clear();
+        m_Grid.FindPairs(m_Circles.data(), n, m_Pairs);
+        Record(m_Results[2], start);
+
+        if (n <= MaxBruteForceCount)
+        {
+            start = Clock::now();
+            m_SoA.Clear();
+            for (const AABB& box : m_Boxes)
+                m_SoA.Add(box);
+            m_Pairs.clear();
+            m_SoA.QuerySelfOverlapPairs(m_Pairs);
+            Record(m_Results[3], start);
+        }
+    }
+
+    void Print(uint32_t frames) const
+    {
+        std::printf("  broadphase comparison (%zu dynamic bodies)\n",
+                    m_Dynamic.size());
+        for (const Result& result : m_Results)
+        {
+            if (result.frames == 0)
+                continue;
+            std::printf("    %-22s %9.3f ms/frame %10.1f pairs/frame\n",
+                        result.name, result.totalMs / frames,
+                        double(result.pairs) / result.frames);
+        }
+    }
+
+private:
+    struct Result
+    {
+        const char* name;
+        double totalMs;
+        uint64_t pairs;
+        uint32_t frames;
+    };
+
+    void Record(Result& result, Clock::time_point start)
+    {
+        result.totalMs += ElapsedMs(start);
+        result.pairs += m_Pairs.size();
+        ++result.frames;
+    }
+
+private:
+    const std::vector<BodyDef>& m_Defs;
+    std::vector<uint32_t> m_Dynamic;
+    std::vector<AABB> m_Boxes;
+    std::vector<Circle> m_Circles;
+    std::vector<OverlapPair> m_Pairs;
+
+    DynamicTree m_Tree;
+    std::vector<uint32_t> m_TreeProxies;
+    SweepAndPrune m_SAP;
+    std::vector<uint32_t> m_SAPProxies;
+    SpatialHashGrid m_Grid;
+    AABBSoA m_SoA;
+
+    Result m_Results[4] = {{"DynamicTree", 0.0, 0, 0},
+                           {"SweepAndPrune", 0.0, 0, 0},
+                           {"SpatialHashGrid", 0.0, 0, 0},
+                           {"AABBSoA brute force", 0.0, 0, 0}};
+};
+
+// 장면 하나를 frames 스텝 돌리고 보고서를 출력합니다. 마지막 상태 해시를
+// 반환합니다.
+uint64_t RunScene(const StressOptions& options, SceneType scene,
+                  uint32_t threadCount)
+{
+    World world;
+    world.SetSleepingEnabled(options.sleeping);
+    std::unique_ptr<JobSystem> jobs;
+    if (threadCount > 1)
+    {
+        jobs = std::make_unique<JobSystem>(threadCount);
+        world.SetJobSystem(jobs.get());
+    }
+
+    const Clock::time_point buildStart = Clock::now();
+    const std::vector<BodyDef> defs =
+        BuildScene(world, {scene, options.bodyCount, options.seed});
+    const double buildMs = ElapsedMs(buildStart);
+
+    std::unique_ptr<BroadphaseComparison> comparison;
+    if (options.compareBroadphase)
+        comparison = std::make_unique<BroadphaseComparison>(defs);
+
+    double total[StageCount] = {};
+    float worst[StageCount] = {};
+    uint32_t worstFrame = 0;
+    size_t maxContacts = 0;
+    for (uint32_t frame = 0; frame < options.frames; ++frame)
+    {
+        world.Step(TimeStep);
+
+        const StepProfile& profile = world.GetProfile();
+        for (size_t s = 0; s < StageCount; ++s)
+        {
+            const float ms = profile.*Stages[s].field;
+            total[s] += ms;
+            if (ms > worst[s])
+            {
+                worst[s] = ms;
+                if (s == StageCount - 1)
+                    worstFrame = frame;
+            }
+        }
+        maxContacts = std::max(maxContacts, world.GetContacts().size());
+
+        if (comparison)
+            comparison->Update(world);
+    }
+
+    const uint64_t hash = world.ComputeStateHash();
+    const uint32_t frames = std::max(options.frames, 1u);
+
+    std::printf("\nscene %s: %u bodies (%zu static), seed %u, %u frames, "
+                "threads %u, build %.2f ms\n",
+                GetSceneName(scene), world.GetBodyCount(),
+                defs.size() - options.bodyCount, options.seed,
+                options.frames, threadCount, buildMs);
+    std::printf("  %-22s %10s %10s %12s\n", "stage", "avg ms", "max ms",
+                "total ms");
+    for (size_t s = 0; s < StageCount; ++s)
+    {
+        std::printf("  %-22s %10.4f %10.4f %12.2f\n", Stages[s].name,
+                    total[s] / frames, double(worst[s]), total[s]);
+    }
+    std::printf("  slowest step            frame %u\n", worstFrame);
+    std::printf("  contacts                %zu last, %zu max\n",
+                world.GetContacts().size(), maxContacts);
+    std::printf("  awake bodies            %u\n", world.GetAwakeBodyCount());
+    const FrameArena& arena = world.GetFrameArena();
+    std::printf("  frame arena high-water  %.1f KiB (%u overflows)\n",
+                double(arena.GetHighWaterMark()) / 1024.0,
+                arena.GetOverflowCount());
+    const uint64_t peak = GetPeakResidentKiB();
+    if (peak != 0)
+    {
+        std::printf("  peak resident memory    %.1f MiB (process)\n",
+                    double(peak) / 1024.0);
+    }
+    std::printf("  state hash              %016" PRIx64 "\n", hash);
+
+    if (comparison)
+        comparison->Print(frames);
+    std::fflush(stdout);
+    return hash;
+}
+
+void PrintUsage(const char* program)
+{
+    std::printf(
+        "usage: %s [options]\n"
+        "  --scene <name|all>    uniform_circles, pyramids, mixed_sizes,\n"
+        "                        dense_pile, sparse_world (기본 all)\n"
+        "  --bodies <n>          동적 body 수 (기본 2048)\n"
+        "  --frames <n>          스텝 수 (기본 600)\n"
+        "  --seed <n>            장면 시드 (기본 1)\n"
+        "  --threads <a,b,...>   스레드 수 목록, 1 = JobSystem 없음 (기본 1)\n"
+        "  --no-sleep            잠들기 끄기\n"
+        "  --broadphase          프레임마다 broadphase 구현 비교\n",
+        program);
+}
+
+bool ParseList(const char* text, std::vector<uint32_t>& outValues)
+{
+    outValues.clear();
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ','))
+    {
+        const long value = std::strtol(item.c_str(), nullptr, 10);
+        if (value <= 0)
+            return false;
+        outValues.push_back(uint32_t(value));
+    }
+    return outValues.empty() == false;
+}
+
+bool ParseOptions(int argc, char** argv, StressOptions& options)
+{
+    std::string scene = "all";
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* arg = argv[i];
+        if (std::strcmp(arg, "--no-sleep") == 0)
+        {
+            options.sleeping = false;
+            continue;
+        }
+        if (std::strcmp(arg, "--broadphase") == 0)
+        {
+            options.compareBroadphase = true;
+            continue;
+        }
+
+        if (i + 1 >= argc)
+            return false;
+        const char* value = argv[++i];
+        if (std::strcmp(arg, "--scene") == 0)
+            scene = value;
+        else if (std::strcmp(arg, "--bodies") == 0)
+            options.bodyCount = uint32_t(std::atoi(value));
+        else if (std::strcmp(arg, "--frames") == 0)
+            options.frames = uint32_t(std::atoi(value));
+        else if (std::strcmp(arg, "--seed") == 0)
+            options.seed = uint32_t(std::strtoul(value, nullptr, 10));
+        else if (std::strcmp(arg, "--threads") == 0)
+        {
+            if (ParseList(value, options.threadCounts) == false)
+                return false;
+        }
+        else
+            return false;
+    }
+
+    if (scene == "all")
+    {
+        for (size_t s = 0; s < size_t(SceneType::Count); ++s)
+            options.scenes.push_back(SceneType(s));
+        return true;
+    }
+    SceneType type;
+    if (FindScene(scene, type) == false)
+        return false;
+    options.scenes.push_back(type);
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    StressOptions options;
+    if (ParseOptions(argc, argv, options) == false)
+    {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::printf("CitadelPhysicsEngine2D stress runner (simd %s, %s)\n",
+                GetSimdLevelName(MaxSimdLevel()),
+#if defined(CPE2D_DETERMINISTIC)
+                "deterministic"
+#else
+                "non-deterministic"
+#endif
+    );
+
+    // 같은 장면은 스레드 수와 관계없이 같은 해시가 나와야 합니다.
+    int result = 0;
+    for (SceneType scene : options.scenes)
+    {
+        uint64_t expected = 0;
+        for (size_t t = 0; t < options.threadCounts.size(); ++t)
+        {
+            const uint64_t hash =
+                RunScene(options, scene, options.threadCounts[t]);
+            if (t == 0)
+            {
+                expected = hash;
+            }
+            else if (hash != expected)
+            {
+                std::printf("  state hash differs from threads %u run\n",
+                            options.threadCounts[0]);
+                result = 1;
+            }
+        }
+    }
+    return result;
+}
@@ -0,0 +1,275 @@
+#include "StressScenes.h"
+
+#include "Benchmark.h"
+
+#include <CitadelPhysicsEngine2D/dynamics/World.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <utility>
+
+namespace CitadelPhysicsEngine2D
+{
+namespace Bench
+{
+
+namespace
+{
+
+const char* const SceneNames[] = {
+    "uniform_circles", "pyramids", "mixed_sizes", "dense_pile",
+    "sparse_world",
+};
+static_assert(sizeof(SceneNames) / sizeof(SceneNames[0]) ==
+                  size_t(SceneType::Count),
+              "scene name table is out of date");
+
+class SceneBuilder
+{
+public:
+    explicit SceneBuilder(World& world) : m_World(world) {}
+
+    void Add(const BodyDef& def)
+    {
+        m_World.CreateBody(def);
+        m_Defs.push_back(def);
+    }
+
+    void AddStaticBox(const glm::vec2& center, const glm::vec2& half)
+    {
+        BodyDef def;
+        def.type = BodyType::Static;
+        def.shape = ShapeType::Box;
+        def.position = center;
+        def.halfExtents = half;
+        Add(def);
+    }
+
+    // 바닥과 양쪽 벽. 안쪽 폭은 width, 벽 높이는 height 입니다.
+    void AddContainer(float width, float height)
+    {
+        AddStaticBox({0.0f, -0.5f}, {0.5f * width + 1.0f, 0.5f});
+        AddStaticBox({-0.5f * width - 0.5f, 0.5f * height},
+                     {0.5f, 0.5f * height});
+        AddStaticBox({0.5f * width + 0.5f, 0.5f * height},
+                     {0.5f, 0.5f * height});
+    }
+
+    std::vector<BodyDef> Release() { return std::move(m_Defs); }
+
+private:
+    World& m_World;
+    std::vector<BodyDef> m_Defs;
+};
+
+// 한 변의 칸 수가 columns 인 격자의 i 번째 칸 중심 (아래 줄부터)
+glm::vec2 GridCell(uint32_t i, uint32_t columns, float spacing,
+                   float width)
+{
+    const float x = (float(i % columns) + 0.5f) * spacing - 0.5f * width;
+    const float y = (float(i / columns) + 0.5f) * spacing;
+    return {x, y};
+}
+
+void BuildUniformCircles(SceneBuilder& builder, uint32_t n, Random& random)
+{
+    const uint32_t columns =
+        std::max(1u, uint32_t(std::ceil(std::sqrt(float(n)))));
+    const float spacing = 1.1f;
+    const float width = float(columns) * spacing;
+    builder.AddContainer(width, float(n / columns + 2) * spacing);
+
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        BodyDef def;
+        def.shape = ShapeType::Circle;
+        def.radius = 0.5f;
+        def.position = GridCell(i, columns, spacing, width) +
+                       glm::vec2(random.Range(-0.04f, 0.04f), 0.5f);
+        builder.Add(def);
+    }
+}
+
+void BuildPyramids(SceneBuilder& builder, uint32_t n)
+{
+    constexpr uint32_t Rows = 40;
+    constexpr uint32_t BoxesPerPyramid = Rows * (Rows + 1) / 2;
+    const uint32_t pyramidCount =
+        std::max(1u, (n + BoxesPerPyramid - 1) / BoxesPerPyramid);
+    const float pyramidWidth = float(Rows) * 1.2f;
+
+    const float groundHalf = 0.5f * pyramidWidth * float(pyramidCount);
+    builder.AddStaticBox({groundHalf, -0.5f}, {groundHalf, 0.5f});
+
+    uint32_t created = 0;
+    for (uint32_t p = 0; p < pyramidCount && created < n; ++p)
+    {
+        for (uint32_t row = 0; row < Rows && created < n; ++row)
+        {
+            for (uint32_t i = 0; i < Rows - row && created < n; ++i)
+            {
+                BodyDef def;
+                def.shape = ShapeType::Box;
+                def.halfExtents = {0.5f, 0.5f};
+                def.position = {pyramidWidth * float(p) + 0.6f +
+                                    float(row) * 0.5f + float(i) * 1.05f,
+                                0.5f + float(row)};
+                builder.Add(def);
+                ++created;
+            }
+        }
+    }
+}
+
+void BuildMixedSizes(SceneBuilder& builder, uint32_t n, Random& random)
+{
+    // 지름은 [0.1, 3) 로그 균등이고, 칸은 가장 큰 물체 기준이라 성기게
+    // 시작합니다.
+    const uint32_t columns =
+        std::max(1u, uint32_t(std::ceil(std::sqrt(float(n)) * 0.5f)));
+    const float spacing = 3.2f;
+    const float width = float(columns) * spacing;
+    builder.AddContainer(width, float(n / columns + 2) * spacing);
+
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        const float size = 0.05f * std::pow(30.0f, random.Range(0.0f, 1.0f));
+        BodyDef def;
+        def.position = GridCell(i, columns, spacing, width);
+        if ((random.NextUInt() & 1) != 0)
+        {
+            def.shape = ShapeType::Circle;
+            def.radius = size;
+        }
+        else
+        {
+            def.shape = ShapeType::Box;
+            def.halfExtents = {size, size * random.Range(0.5f, 1.0f)};
+            def.angle = random.Range(0.0f, 3.1415927f);
+        }
+        def.linearVelocity = {random.Range(-1.0f, 1.0f), 0.0f};
+        builder.Add(def);
+    }
+}
+
+void BuildDensePile(SceneBuilder& builder, uint32_t n, Random& random)
+{
+    // 통의 폭을 body 수의 제곱근에 비례해 좁게 잡아 높이 쌓이게 합니다.
+    const uint32_t columns =
+        std::max(4u, uint32_t(std::sqrt(float(n)) * 0.5f));
+    const float spacing = 0.75f;
+    const float width = float(columns) * spacing;
+    builder.AddContainer(width, float(n / columns + 2) * spacing);
+
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        BodyDef def;
+        def.position = GridCell(i, columns, spacing, width);
+        def.friction = 0.6f;
+        if (i % 3 == 0)
+        {
+            def.shape = ShapeType::Box;
+            def.halfExtents = {random.Range(0.2f, 0.35f),
+                               random.Range(0.2f, 0.35f)};
+            def.angle = random.Range(-0.3f, 0.3f);
+        }
+        else
+        {
+            def.shape = ShapeType::Circle;
+            def.radius = random.Range(0.2f, 0.35f);
+        }
+        builder.Add(def);
+    }
+}
+
+void BuildSparseWorld(World& world, SceneBuilder& builder, uint32_t n,
+                      Random& random)
+{
+    // body 하나당 평균 100 m^2. 벽 없이 열린 공간이라 물체가 계속 흩어집니다.
+    world.SetGravity({0.0f, 0.0f});
+    const float extent = std::sqrt(float(n) * 100.0f);
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        BodyDef def;
+        def.position = {random.Range(0.0f, extent),
+                        random.Range(0.0f, extent)};
+        def.linearVelocity = {random.Range(-5.0f, 5.0f),
+                              random.Range(-5.0f, 5.0f)};
+        def.angularVelocity = random.Range(-2.0f, 2.0f);
+        if (i % 2 == 0)
+        {
+            def.shape = ShapeType::Circle;
+            def.radius = random.Range(0.25f, 1.0f);
+        }
+        else
+        {
+            def.shape = ShapeType::Box;
+            def.halfExtents = {random.Range(0.25f, 1.0f),
+                               random.Range(0.25f, 1.0f)};
+        }
+        builder.Add(def);
+    }
+}
+
+} // namespace
+
+const char* GetSceneName(SceneType type)
+{
+    assert(type < SceneType::Count);
+    return SceneNames[size_t(type)];
+}
+
+bool FindScene(const std::string& name, SceneType& outType)
+{
+    for (size_t i = 0; i < size_t(SceneType::Count); ++i)
+    {
+        if (name == SceneNames[i])
+        {
+            outType = SceneType(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief 설정에 맞는 장면을 world 에 만듭니다.
+ *
+ * 정적 body(바닥 / 벽)를 먼저 만들고 동적 body 를 아래 줄부터 채웁니다.
+ * 무작위 값은 모두 settings.seed 로 시작한 Random 에서 정해진 순서로
+ * 뽑으므로 같은 설정이면 같은 장면이 만들어집니다.
+ */
+std::vector<BodyDef> BuildScene(World& world, const SceneSettings& settings)
+{
+    assert(world.GetBodyCount() == 0);
+    SceneBuilder builder(world);
+    Random random(settings.seed);
+    const uint32_t n = settings.bodyCount;
+
+    switch (settings.type)
+    {
+    case SceneType::UniformCircles:
+        BuildUniformCircles(builder, n, random);
+        break;
+    case SceneType::Pyramids:
+        BuildPyramids(builder, n);
+        break;
+    case SceneType::MixedSizes:
+        BuildMixedSizes(builder, n, random);
+        break;
+    case SceneType::DensePile:
+        BuildDensePile(builder, n, random);
+        break;
+    case SceneType::SparseWorld:
+        BuildSparseWorld(world, builder, n, random);
+        break;
+    default:
+        assert(false);
+        break;
+    }
+    return builder.Release();
+}
+
+} // namespace Bench
+} // namespace CitadelPhysicsEngine2D
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <CitadelPhysicsEngine2D/dynamics/Body.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace CitadelPhysicsEngine2D
+{
+
+class World;
+
+namespace Bench
+{
+
+// 창 없이 엔진을 돌리는 합성 장면
+// 같은 종류 / body 수 / 시드면 언제나 같은 BodyDef 순서로 만들어지므로
+// 마지막 상태 해시로 빌드나 스레드 수 사이의 결과를 비교할 수 있습니다.
+enum class SceneType : uint8_t
+{
+    UniformCircles, // 같은 크기의 원을 상자 안에 떨어뜨림
+    Pyramids,       // 40 단 상자 피라미드를 옆으로 이어 붙임 (시드 무시)
+    MixedSizes,     // 크기가 30 배까지 다른 원과 회전한 상자
+    DensePile,      // 좁은 통에 작은 물체를 높이 쌓음 (접촉 밀도 최대)
+    SparseWorld,    // 무중력의 넓은 공간에 흩어져 날아다니는 물체
+    Count,
+};
+
+struct SceneSettings
+{
+    SceneType type = SceneType::Pyramids;
+    uint32_t bodyCount = 1024; // 동적 body 수 (벽 / 바닥은 따로)
+    uint32_t seed = 1;
+};
+
+// "uniform_circles", "pyramids", "mixed_sizes", "dense_pile", "sparse_world"
+const char* GetSceneName(SceneType type);
+bool FindScene(const std::string& name, SceneType& outType);
+
+// world 에 장면을 만들고 생성 순서(= 밀집 인덱스)대로 BodyDef 를
+// 돌려줍니다. 빈 World 에서 불러야 합니다.
+std::vector<BodyDef> BuildScene(World& world, const SceneSettings& settings);
+
+} // namespace Bench
+} // namespace CitadelPhysicsEngine2D
@@ -0,0 +1,6 @@
+#pragma once
+
+#include "DynamicTree.h"
+#include "ParallelPairFinder.h"
+#include "SpatialHashGrid.h"
+#include "SweepAndPrune.h"
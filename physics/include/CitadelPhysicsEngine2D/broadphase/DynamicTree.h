@@ -0,0 +1,137 @@
+#pragma once
+
+#include <CitadelPhysicsEngine2D/shapes/AABB.h>
+#include <CitadelPhysicsEngine2D/shapes/OverlapPair.h>
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+namespace CitadelPhysicsEngine2D
+{
+
+class SnapshotReader;
+class SnapshotWriter;
+
+// 동적 AABB 트리 (BVH)
+// 리프는 margin 만큼 확장한 fat AABB 를 가지며, 물체가 fat AABB 를 벗어날
+// 때만 트리를 갱신합니다. 노드는 인덱스로 연결된 연속 배열(pool)에
+// 저장되고, 삽입/제거 후 회전으로 높이 균형을 유지합니다.
+class DynamicTree
+{
+public:
+    static constexpr uint32_t NullNode = 0xFFFFFFFFu;
+    static constexpr uint32_t StackCapacity = 256;
+
+    explicit DynamicTree(float aabbMargin = 0.1f);
+
+    uint32_t CreateProxy(const AABB& aabb, uint32_t userData);
+    void DestroyProxy(uint32_t proxyId);
+
+    // fat AABB 를 벗어난 경우에만 재삽입하고 true 를 반환합니다.
+    // displacement 는 예측 이동량으로 fat AABB 를 그 방향으로 늘립니다.
+    bool MoveProxy(uint32_t proxyId, const AABB& aabb,
+                   const glm::vec2& displacement = glm::vec2(0.0f));
+
+    uint32_t GetUserData(uint32_t proxyId) const
+    {
+        return m_Nodes[proxyId].userData;
+    }
+    void SetUserData(uint32_t proxyId, uint32_t userData)
+    {
+        m_Nodes[proxyId].userData = userData;
+    }
+    const AABB& GetFatAABB(uint32_t proxyId) const
+    {
+        return m_Nodes[proxyId].aabb;
+    }
+
+    // aabb 와 겹치는 리프마다 callback(proxyId) 를 호출합니다.
+    // callback 이 false 를 반환하면 질의를 중단합니다.
+    template <typename Callback>
+    void Query(const AABB& aabb, Callback&& callback) const;
+
+    // 모든 fat AABB 충돌 쌍 (a < b 프록시 id, 사전순)
+    void QueryAllPairs(std::vector<OverlapPair>& outPairs) const;
+
+    // 마지막 호출 이후 재삽입된 프록시가 포함된 쌍만 찾고 이동 버퍼를 비웁니다.
+    void QueryMovedPairs(std::vector<OverlapPair>& outPairs);
+
+    // 노드 풀과 이동 버퍼를 그대로 저장 / 복원합니다. (재구축 없음)
+    void SaveState(SnapshotWriter& writer) const;
+    void RestoreState(SnapshotReader& reader);
+
+    uint32_t GetProxyCount() const { return m_ProxyCount; }
+    int32_t GetHeight() const;
+    bool Validate() const;
+
+private:
+    struct TreeNode
+    {
+        AABB aabb;
+        uint32_t parent; // 빈 노드에서는 free list 의 다음 노드
+        uint32_t child1;
+        uint32_t child2;
+        int32_t height; // 리프 = 0, 빈 노드 = -1
+        uint32_t userData;
+        uint32_t moveSlot; // 이동 버퍼 안의 위치, 없으면 NullNode
+
+        bool IsLeaf() const { return child1 == NullNode; }
+    };
+
+    uint32_t AllocateNode();
+    void FreeNode(uint32_t nodeId);
+    void BufferMove(uint32_t proxyId);
+
+    void InsertLeaf(uint32_t leaf);
+    void RemoveLeaf(uint32_t leaf);
+    void RefitAncestors(uint32_t nodeId);
+    uint32_t Balance(uint32_t a);
+
+    bool ValidateNode(uint32_t nodeId) const;
+    void SortPairs(std::vector<OverlapPair>& pairs) const;
+
+private:
+    std::vector<TreeNode> m_Nodes;
+    uint32_t m_Root = NullNode;
+    uint32_t m_FreeList = NullNode;
+    uint32_t m_ProxyCount = 0;
+    float m_AABBMargin;
+
+    std::vector<uint32_t> m_MoveBuffer;
+};
+
+template <typename Callback>
+void DynamicTree::Query(const AABB& aabb, Callback&& callback) const
+{
+    if (m_Root == NullNode)
+        return;
+
+    // 회전으로 균형을 유지하므로 높이는 O(log n) 이고 고정 스택이면 충분합니다.
+    // 지역 스택을 사용하므로 여러 스레드에서 동시에 질의할 수 있습니다.
+    uint32_t stack[StackCapacity];
+    uint32_t count = 0;
+    stack[count++] = m_Root;
+    while (count > 0)
+    {
+        uint32_t nodeId = stack[--count];
+
+        const TreeNode& node = m_Nodes[nodeId];
+        if (AABB::AABBvsAABB(node.aabb, aabb) == true)
+            continue;
+
+        if (node.IsLeaf())
+        {
+            if (callback(nodeId) == false)
+                return;
+        }
+        else
+        {
+            assert(count + 2 <= StackCapacity);
+            stack[count++] = node.child1;
+            stack[count++] = node.child2;
+        }
+    }
+}
+
+} // namespace CitadelPhysicsEngine2D
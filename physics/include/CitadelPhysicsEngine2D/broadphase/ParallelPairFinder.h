@@ -0,0 +1,40 @@
+#pragma once
+
+#include <CitadelPhysicsEngine2D/shapes/AABBSoA.h>
+#include <CitadelPhysicsEngine2D/shapes/OverlapPair.h>
+#include <CitadelPhysicsEngine2D/threading/JobSystem.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace CitadelPhysicsEngine2D
+{
+
+// 질의 집합을 스레드 수만큼 연속 구간으로 나눠 병렬로 쌍을 찾습니다.
+// 각 구간은 자기 버퍼에만 기록하고 구간 순서대로 이어 붙이므로,
+// 결과 순서는 스레드 수와 관계없이 단일 스레드 결과와 같습니다.
+class ParallelPairFinder
+{
+public:
+    explicit ParallelPairFinder(JobSystem& jobs);
+
+    // boxes 내부의 a < b 충돌 쌍 (QuerySelfOverlapPairs 와 같은 순서)
+    void FindSelfPairs(const AABBSoA& boxes,
+                       std::vector<OverlapPair>& outPairs,
+                       SimdLevel level = MaxSimdLevel());
+
+    // queries[a] 와 targets[b] 의 충돌 쌍 (QueryOverlapPairs 와 같은 순서)
+    void FindPairs(const AABBSoA& queries, const AABBSoA& targets,
+                   std::vector<OverlapPair>& outPairs,
+                   SimdLevel level = MaxSimdLevel());
+
+private:
+    void Merge(std::vector<OverlapPair>& outPairs) const;
+
+private:
+    JobSystem& m_Jobs;
+    std::vector<uint32_t> m_RangeStart;
+    std::vector<std::vector<OverlapPair>> m_RangePairs;
+};
+
+} // namespace CitadelPhysicsEngine2D
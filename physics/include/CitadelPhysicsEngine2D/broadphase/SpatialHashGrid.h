@@ -0,0 +1,60 @@
+#pragma once
+
+#include <CitadelPhysicsEngine2D/shapes/Circle.h>
+#include <CitadelPhysicsEngine2D/shapes/CircleSoA.h>
+#include <CitadelPhysicsEngine2D/shapes/OverlapPair.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace CitadelPhysicsEngine2D
+{
+
+// 크기가 비슷한 원을 위한 균일 격자 해시 broadphase
+// 매 단계 원을 중심이 속한 셀로 counting sort 하여 연속 배열에 저장하고,
+// 3x3 이웃 셀만 검사합니다. 결과는 모든 쌍에 CirclevsCircle 을 적용한
+// 결과와 같습니다. (a < b, 사전순)
+class SpatialHashGrid
+{
+public:
+    explicit SpatialHashGrid(float cellSize = 1.0f);
+
+    // 가장 큰 지름보다 작으면 FindPairs 에서 지름으로 늘려 사용합니다.
+    void SetCellSize(float cellSize) { m_CellSize = cellSize; }
+    float GetCellSize() const { return m_CellSize; }
+
+    void FindPairs(const CircleSoA& circles,
+                   std::vector<OverlapPair>& outPairs);
+    void FindPairs(const Circle* circles, uint32_t count,
+                   std::vector<OverlapPair>& outPairs);
+
+private:
+    void Build(const float* x, const float* y, const float* radius,
+               uint32_t count);
+    void Sweep(const float* x, const float* y, const float* radius,
+               std::vector<OverlapPair>& outPairs) const;
+
+    uint32_t HashCell(int32_t cx, int32_t cy) const;
+    int32_t CellCoord(float v) const;
+
+private:
+    float m_CellSize;
+    float m_EffectiveCellSize = 1.0f;
+    float m_InvCellSize = 1.0f;
+    uint32_t m_TableMask = 0;
+
+    // counting sort 결과: 셀 순서로 정렬된 원 데이터
+    std::vector<uint32_t> m_CellStart; // tableSize + 1
+    std::vector<uint32_t> m_BodyCell;  // 원본 인덱스별 해시
+    std::vector<uint32_t> m_SortedIndex;
+    std::vector<float> m_SortedX;
+    std::vector<float> m_SortedY;
+    std::vector<float> m_SortedRadius;
+
+    // AoS 입력을 모으는 버퍼
+    std::vector<float> m_InputX;
+    std::vector<float> m_InputY;
+    std::vector<float> m_InputRadius;
+};
+
+} // namespace CitadelPhysicsEngine2D
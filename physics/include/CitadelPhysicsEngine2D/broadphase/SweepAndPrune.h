@@ -0,0 +1,51 @@
+#pragma once
+
+#include <CitadelPhysicsEngine2D/shapes/AABB.h>
+#include <CitadelPhysicsEngine2D/shapes/OverlapPair.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace CitadelPhysicsEngine2D
+{
+
+// 축별 끝점(endpoint) 리스트를 프레임 간에 유지하는 Sort-and-Sweep broadphase
+// 물체가 조금씩 움직이면 리스트가 거의 정렬된 상태이므로 삽입 정렬이
+// O(n + 교환 수)로 끝납니다.
+class SweepAndPrune
+{
+public:
+    static constexpr uint32_t NullProxy = 0xFFFFFFFFu;
+
+    uint32_t CreateProxy(const AABB& box);
+    void DestroyProxy(uint32_t proxyId);
+    void MoveProxy(uint32_t proxyId, const AABB& box);
+
+    const AABB& GetAABB(uint32_t proxyId) const { return m_Proxies[proxyId]; }
+    uint32_t GetProxyCount() const { return m_ProxyCount; }
+
+    // 끝점 리스트를 갱신하고 잠재 충돌 쌍을 outPairs 에 기록합니다.
+    // 각 쌍은 a < b 로 정규화되고 (a, b) 사전순으로 정렬되어 중복이 없습니다.
+    void UpdatePairs(std::vector<OverlapPair>& outPairs);
+
+private:
+    struct Endpoint
+    {
+        float value;
+        uint32_t data; // (proxyId << 1) | isMax
+    };
+
+    void RefreshEndpoints(std::vector<Endpoint>& endpoints, int axis) const;
+    static void InsertionSort(std::vector<Endpoint>& endpoints);
+
+private:
+    std::vector<AABB> m_Proxies;
+    std::vector<uint8_t> m_Alive;
+    std::vector<uint32_t> m_FreeList;
+    uint32_t m_ProxyCount = 0;
+
+    std::vector<Endpoint> m_Endpoints[2]; // x, y 축
+    std::vector<uint32_t> m_Active;
+};
+
+} // namespace CitadelPhysicsEngine2D
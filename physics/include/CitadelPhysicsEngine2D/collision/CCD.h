@@ -0,0 +1,62 @@
+#pragma once
+
+#include <CitadelPhysicsEngine2D/shapes/AABB.h>
+#include <CitadelPhysicsEngine2D/shapes/AABBSoA.h>
+#include <CitadelPhysicsEngine2D/shapes/Circle.h>
+#include <CitadelPhysicsEngine2D/shapes/CircleSoA.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace CitadelPhysicsEngine2D
+{
+
+// 스윕 질의 결과. t 는 이번 스텝 변위에 대한 비율 [0, 1] 이며,
+// normal 은 A 에서 B 를 향합니다. 시작부터 겹쳐 있으면 t == 0 입니다.
+struct TOIResult
+{
+    float t = 1.0f;
+    glm::vec2 normal = {0.0f, 0.0f};
+};
+
+// 두 원이 각각 dA, dB 만큼 이동할 때 처음 닿는 시점
+bool TimeOfImpactCircles(const Circle& a, const glm::vec2& dA,
+                         const Circle& b, const glm::vec2& dB,
+                         TOIResult& result);
+
+// 원이 d 만큼 이동할 때 정지한 AABB 에 처음 닿는 시점
+bool TimeOfImpactCircleAABB(const Circle& a, const glm::vec2& d,
+                            const AABB& b, TOIResult& result);
+
+struct CCDSettings
+{
+    // |변위| > motionThreshold * radius 인 원은 bullet 이 아니어도 검사
+    float motionThreshold = 0.5f;
+};
+
+// 이번 스텝 변위가 d 인 반지름 radius 의 원을 스윕 검사해야 하는지
+bool NeedsTimeOfImpact(const glm::vec2& d, float radius, bool bullet,
+                       const CCDSettings& settings);
+
+// CCD 단계가 찾은 원 하나의 가장 이른 충돌
+struct TOIEvent
+{
+    uint32_t circle;  // circles 인덱스
+    uint32_t other;   // otherIsBox 에 따라 boxes 또는 circles 인덱스
+    bool otherIsBox;
+    TOIResult toi;
+};
+
+// bullet 이거나 빠르게 움직이는 원만 골라 정지한 상자와 다른 원에 대해
+// 스윕 검사를 하고, 원마다 가장 이른 충돌을 outEvents 에 추가합니다.
+// displacements 는 이번 스텝의 원별 변위, bullets 는 nullptr 일 수 있습니다.
+// 결과는 circle 인덱스 오름차순입니다.
+// scratch 를 주면 내부 임시 배열을 그 arena 에서 할당합니다.
+uint32_t FindTimeOfImpacts(const CircleSoA& circles,
+                           const glm::vec2* displacements,
+                           const uint8_t* bullets, const AABBSoA& boxes,
+                           const CCDSettings& settings,
+                           std::vector<TOIEvent>& outEvents,
+                           StackArena* scratch = nullptr);
+
+} // namespace CitadelPhysicsEngine2D
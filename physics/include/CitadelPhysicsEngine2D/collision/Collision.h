@@ -0,0 +1,7 @@
+#pragma once
+
+#include "CCD.h"
+#include "ContactManifold.h"
+#include "GJK.h"
+#include "Narrowphase.h"
+#include "SAT.h"
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <CitadelPhysicsEngine2D/math/EngineMath.h>
+
+#include <cstdint>
+
+namespace CitadelPhysicsEngine2D
+{
+
+// 충돌 판정과 같은 패스에서 채워지는 접촉 정보
+// normal 은 A 에서 B 를 향하며, B 를 normal * penetration 만큼 옮기면
+// 두 도형이 분리됩니다.
+struct ContactManifold
+{
+    uint32_t a = 0;
+    uint32_t b = 0;
+    glm::vec2 normal = {0.0f, 0.0f};
+    float penetration = 0.0f; // 접촉점 깊이 중 최대값
+    uint32_t pointCount = 0;
+    glm::vec2 points[2];
+    float depths[2]; // 접촉점별 침투 깊이
+};
+
+} // namespace CitadelPhysicsEngine2D
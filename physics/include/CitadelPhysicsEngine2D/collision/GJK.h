@@ -0,0 +1,63 @@
+#pragma once
+
+#include <CitadelPhysicsEngine2D/collision/ContactManifold.h>
+#include <CitadelPhysicsEngine2D/math/Transform2D.h>
+#include <CitadelPhysicsEngine2D/shapes/AABB.h>
+#include <CitadelPhysicsEngine2D/shapes/Circle.h>
+#include <CitadelPhysicsEngine2D/shapes/OBB.h>
+#include <CitadelPhysicsEngine2D/shapes/Polygon.h>
+
+#include <cstdint>
+
+namespace CitadelPhysicsEngine2D
+{
+
+// GJK/EPA 가 사용하는 볼록 도형 표현: 월드 좌표 정점 껍질 + 둥근 반지름
+// 지지 함수는 Support(d) = 정점 중 dot(v, d) 최대 + radius * d / |d| 입니다.
+// 새 도형은 이 표현을 만드는 From* 함수만 추가하면 GJK 경로를 그대로 씁니다.
+struct ConvexProxy
+{
+    glm::vec2 vertices[Polygon::MaxVertices];
+    uint32_t count = 0;
+    float radius = 0.0f;
+
+    static ConvexProxy FromCircle(const Circle& circle);
+    static ConvexProxy FromAABB(const AABB& box);
+    static ConvexProxy FromOBB(const OBB& box);
+    static ConvexProxy FromPolygon(const Polygon& polygon,
+                                   const Transform2D& xf);
+
+    // 반지름을 제외한 정점 껍질의 지지 정점 인덱스
+    uint32_t GetSupport(const glm::vec2& direction) const;
+};
+
+// 쌍마다 유지하는 지난 프레임의 단체(simplex) 정점 인덱스
+// 일관된 움직임에서는 GJK 가 1~2 회 반복으로 수렴합니다.
+struct SimplexCache
+{
+    uint8_t count = 0;
+    uint8_t indexA[3];
+    uint8_t indexB[3];
+};
+
+struct DistanceOutput
+{
+    glm::vec2 pointA; // A 표면의 최근접점
+    glm::vec2 pointB; // B 표면의 최근접점
+    float distance;   // 겹치면 0
+    uint32_t iterations;
+};
+
+// 두 볼록 도형 사이의 거리와 최근접점
+DistanceOutput GJKDistance(const ConvexProxy& a, const ConvexProxy& b,
+                           SimplexCache* cache = nullptr);
+
+// 충돌 여부 (경계 접촉 포함 시 true)
+bool GJKOverlap(const ConvexProxy& a, const ConvexProxy& b,
+                SimplexCache* cache = nullptr);
+
+// 충돌하면 EPA 로 침투 깊이/법선을 구해 manifold 를 채웁니다. (접촉점 1개)
+bool GJKCollide(const ConvexProxy& a, const ConvexProxy& b,
+                ContactManifold& manifold, SimplexCache* cache = nullptr);
+
+} // namespace CitadelPhysicsEngine2D
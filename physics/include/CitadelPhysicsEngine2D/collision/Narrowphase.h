@@ -0,0 +1,37 @@
+#pragma once
+
+#include <CitadelPhysicsEngine2D/collision/ContactManifold.h>
+#include <CitadelPhysicsEngine2D/shapes/AABB.h>
+#include <CitadelPhysicsEngine2D/shapes/AABBSoA.h>
+#include <CitadelPhysicsEngine2D/shapes/Circle.h>
+#include <CitadelPhysicsEngine2D/shapes/CircleSoA.h>
+#include <CitadelPhysicsEngine2D/shapes/OverlapPair.h>
+
+#include <cstdint>
+
+namespace CitadelPhysicsEngine2D
+{
+
+// 충돌하면 manifold 를 채우고 true 를 반환합니다. (경계 접촉 포함)
+// 판정 결과는 CirclevsCircle / AABBvsAABB 의 반대값과 같습니다.
+bool CollideCircles(const Circle& a, const Circle& b,
+                    ContactManifold& manifold);
+bool CollideAABBs(const AABB& a, const AABB& b, ContactManifold& manifold);
+bool CollideCircleAABB(const Circle& a, const AABB& b,
+                       ContactManifold& manifold);
+
+// pair 리스트를 순회하며 충돌한 쌍의 manifold 만 앞에서부터 채웁니다.
+// outManifolds 는 pairCount 개를 담을 수 있어야 하며, 기록한 수를 반환합니다.
+// manifold.a / manifold.b 에는 pair 의 인덱스가 그대로 기록됩니다.
+uint32_t CollideCirclesBatch(const CircleSoA& circles,
+                             const OverlapPair* pairs, uint32_t pairCount,
+                             ContactManifold* outManifolds);
+uint32_t CollideAABBsBatch(const AABBSoA& boxes, const OverlapPair* pairs,
+                           uint32_t pairCount, ContactManifold* outManifolds);
+// pair.a 는 circles, pair.b 는 boxes 의 인덱스입니다.
+uint32_t CollideCircleAABBBatch(const CircleSoA& circles,
+                                const AABBSoA& boxes,
+                                const OverlapPair* pairs, uint32_t pairCount,
+                                ContactManifold* outManifolds);
+
+} // namespace CitadelPhysicsEngine2D
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <CitadelPhysicsEngine2D/collision/ContactManifold.h>
+#include <CitadelPhysicsEngine2D/math/Transform2D.h>
+#include <CitadelPhysicsEngine2D/shapes/OBB.h>
+#include <CitadelPhysicsEngine2D/shapes/Polygon.h>
+
+#include <cstdint>
+
+namespace CitadelPhysicsEngine2D
+{
+
+// 쌍마다 프레임 간에 유지하는 분리축 캐시
+// 지난 프레임의 분리축이 여전히 분리하면 축 하나만 검사하고 끝납니다.
+struct SATCache
+{
+    uint8_t valid = 0;
+    uint8_t onB = 0; // 0: A 의 변 법선, 1: B 의 변 법선
+    uint8_t edge = 0;
+};
+
+// 분리축 정리로 충돌을 판정하고 변 클리핑으로 최대 2개의 접촉점을 만듭니다.
+// 첫 분리축에서 바로 반환하며, cache 가 있으면 먼저 캐시된 축을 검사합니다.
+bool CollidePolygons(const Polygon& a, const Transform2D& xfA,
+                     const Polygon& b, const Transform2D& xfB,
+                     ContactManifold& manifold, SATCache* cache = nullptr);
+
+bool CollideOBBs(const OBB& a, const OBB& b, ContactManifold& manifold,
+                 SATCache* cache = nullptr);
+
+} // namespace CitadelPhysicsEngine2D
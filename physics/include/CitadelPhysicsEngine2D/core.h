@@ -2,6 +2,16 @@
 
 #include "math/EngineMath.h"
 
+#include "memory/Memory.h"
+
 #include "shapes/Shapes.h"
 
+#include "broadphase/Broadphase.h"
+#include "collision/Collision.h"
+
+#include "dynamics/Dynamics.h"
+
+#include "threading/Threading.h"
+#include "profiling/Profiling.h"
+
 namespace CPE2D = CitadelPhysicsEngine2D;
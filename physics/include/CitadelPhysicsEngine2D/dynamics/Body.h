@@ -0,0 +1,63 @@
+#pragma once
+
+#include <CitadelPhysicsEngine2D/math/EngineMath.h>
+
+#include <cstdint>
+
+namespace CitadelPhysicsEngine2D
+{
+
+enum class BodyType : uint8_t
+{
+    Static,
+    Dynamic,
+};
+
+enum class ShapeType : uint8_t
+{
+    Circle,
+    Box,
+};
+
+// World 의 body 를 가리키는 핸들 (id + 세대)
+// id 는 body 가 살아 있는 동안 바뀌지 않습니다. body 가 제거되면 id 의
+// 세대가 올라가 이전 핸들은 무효가 됩니다.
+struct BodyHandle
+{
+    static constexpr uint32_t InvalidIndex = 0xFFFFFFFFu;
+
+    uint32_t index = InvalidIndex;
+    uint32_t generation = 0;
+
+    bool operator==(const BodyHandle& other) const
+    {
+        return index == other.index && generation == other.generation;
+    }
+    bool operator!=(const BodyHandle& other) const
+    {
+        return (*this == other) == false;
+    }
+};
+
+struct BodyDef
+{
+    BodyType type = BodyType::Dynamic;
+    ShapeType shape = ShapeType::Circle;
+
+    glm::vec2 position = {0.0f, 0.0f};
+    float angle = 0.0f; // 라디안
+    glm::vec2 linearVelocity = {0.0f, 0.0f};
+    float angularVelocity = 0.0f;
+
+    float radius = 0.5f;                    // ShapeType::Circle
+    glm::vec2 halfExtents = {0.5f, 0.5f};   // ShapeType::Box
+
+    float density = 1.0f;
+    float friction = 0.4f;
+    float restitution = 0.0f;
+
+    // 매 스텝 연속 충돌 검사 대상 (원만 지원)
+    bool bullet = false;
+};
+
+} // namespace CitadelPhysicsEngine2D
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <CitadelPhysicsEngine2D/collision/GJK.h>
+#include <CitadelPhysicsEngine2D/collision/SAT.h>
+#include <CitadelPhysicsEngine2D/math/EngineMath.h>
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+namespace CitadelPhysicsEngine2D
+{
+
+class SnapshotReader;
+class SnapshotWriter;
+
+// 한 body 쌍의 지난 접촉 (warm start / 접촉 이벤트용)
+// 닿지 않았어도 broadphase 쌍이면 분리축 / 단체만 담은 항목으로 남습니다.
+struct CachedContact
+{
+    uint64_t key;         // ContactCache::MakeKey(a, b), 빈 칸은 EmptyKey
+    uint32_t generationA; // 슬롯이 재사용되었는지 확인용
+    uint32_t generationB;
+    uint32_t lastStep;     // 마지막으로 닿아 있던 스텝
+    uint32_t lastPairStep; // 마지막으로 broadphase 쌍이었던 스텝
+    uint8_t touching;      // 시작 이벤트 뒤 아직 끝 이벤트가 없으면 1
+    uint32_t pointCount;
+    glm::vec2 points[2]; // 월드 좌표
+    float normalImpulses[2];
+    float tangentImpulses[2];
+
+    // narrowphase 가 다음 스텝에 이어 쓰는 분리축 / 단체
+    // (A 는 키의 작은 id 쪽 body)
+    SATCache sat;
+    SimplexCache simplex;
+};
+
+// (a, b) body 쌍을 64 비트 키로 찾는 open addressing 해시 테이블
+// 항목은 연속 배열 하나에 선형 탐사로 저장되고, 제거는 뒤 항목을 당겨
+// 채우는 backward shift 방식이라 tombstone 이 쌓이지 않습니다.
+// 오래된 항목은 SweepStale 로 스텝마다 일부 칸씩만 검사해 지웁니다.
+class ContactCache
+{
+public:
+    static constexpr uint64_t EmptyKey = ~uint64_t(0);
+
+    static uint64_t MakeKey(uint32_t a, uint32_t b)
+    {
+        assert(a < b);
+        return (static_cast<uint64_t>(a) << 32) | b;
+    }
+    static uint32_t KeyA(uint64_t key) { return uint32_t(key >> 32); }
+    static uint32_t KeyB(uint64_t key) { return uint32_t(key); }
+
+    CachedContact* Find(uint64_t key);
+    const CachedContact* Find(uint64_t key) const;
+    // 없으면 pointCount 가 0 인 항목을 만들고 inserted 를 true 로 설정합니다.
+    // 반환된 참조는 다음 Insert / Remove 전까지만 유효합니다.
+    CachedContact& Insert(uint64_t key, bool& inserted);
+    bool Remove(uint64_t key);
+    void Clear();
+
+    // 이전 호출에 이어 최대 slotCount 칸을 검사하며 isStale(entry) 가 true
+    // 인 항목을 지우고 onRemove(entry) 를 호출합니다. 지운 수를 반환합니다.
+    template <typename IsStale, typename OnRemove>
+    uint32_t SweepStale(uint32_t slotCount, IsStale&& isStale,
+                        OnRemove&& onRemove);
+
+    uint32_t GetSize() const { return m_Size; }
+    uint32_t GetCapacity() const
+    {
+        return static_cast<uint32_t>(m_Entries.size());
+    }
+
+    void SaveState(SnapshotWriter& writer) const;
+    void RestoreState(SnapshotReader& reader);
+
+private:
+    uint32_t HomeSlot(uint64_t key) const;
+    uint32_t FindSlot(uint64_t key) const; // 없으면 capacity
+    void RemoveAt(uint32_t slot);
+    void Grow();
+
+private:
+    std::vector<CachedContact> m_Entries; // 크기는 0 또는 2 의 거듭제곱
+    uint32_t m_Size = 0;
+    uint32_t m_Shift = 64; // 64 - log2(capacity)
+    uint32_t m_SweepCursor = 0;
+};
+
+template <typename IsStale, typename OnRemove>
+uint32_t ContactCache::SweepStale(uint32_t slotCount, IsStale&& isStale,
+                                  OnRemove&& onRemove)
+{
+    const uint32_t capacity = GetCapacity();
+    if (m_Size == 0)
+        return 0;
+
+    uint32_t removed = 0;
+    slotCount = slotCount < capacity ? slotCount : capacity;
+    for (uint32_t n = 0; n < slotCount;)
+    {
+        // 지우면 뒤 항목이 이 칸으로 당겨질 수 있으므로 같은 칸을 다시 봅니다.
+        // 항목은 커서 뒤쪽에서 당겨지므로 한 바퀴에 모든 항목을 검사합니다.
+        const uint32_t slot = m_SweepCursor;
+        const CachedContact& entry = m_Entries[slot];
+        if (entry.key != EmptyKey && isStale(entry))
+        {
+            onRemove(entry);
+            RemoveAt(slot);
+            ++removed;
+            continue;
+        }
+        m_SweepCursor = (m_SweepCursor + 1) & (capacity - 1);
+        ++n;
+    }
+    return removed;
+}
+
+} // namespace CitadelPhysicsEngine2D
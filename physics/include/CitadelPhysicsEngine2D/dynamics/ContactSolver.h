@@ -0,0 +1,188 @@
+#pragma once
+
+#include <CitadelPhysicsEngine2D/collision/ContactManifold.h>
+#include <CitadelPhysicsEngine2D/dynamics/ContactCache.h>
+#include <CitadelPhysicsEngine2D/math/EngineMath.h>
+#include <CitadelPhysicsEngine2D/math/Simd.h>
+#include <CitadelPhysicsEngine2D/memory/AlignedAllocator.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace CitadelPhysicsEngine2D
+{
+
+class JobSystem;
+
+// 솔버가 읽고 쓰는 World 의 SoA body 배열 (슬롯 인덱스)
+struct SolverBodies
+{
+    float* velocityX;
+    float* velocityY;
+    float* angularVelocity;
+    float* positionX;
+    float* positionY;
+    float* angle;
+    const float* invMass;
+    const float* invInertia;
+    const float* friction;
+    const float* restitution;
+};
+
+struct ContactConstraintPoint
+{
+    glm::vec2 point;     // 월드 좌표 (다음 스텝 warm start 매칭용)
+    glm::vec2 rA;        // A 중심 → 접촉점
+    glm::vec2 rB;        // B 중심 → 접촉점
+    glm::vec2 localA;    // A 로컬 좌표의 rA (위치 보정 단계용)
+    glm::vec2 localB;
+    float depth;         // 접촉 시점의 침투 깊이
+    float normalImpulse; // 누적 충격량
+    float tangentImpulse;
+    float normalMass;
+    float tangentMass;
+    float velocityBias;
+};
+
+// 접촉 하나의 속도 제약. 스텝마다 연속 배열로 한 번 만들어 반복에 재사용합니다.
+struct ContactConstraint
+{
+    uint32_t a;
+    uint32_t b;
+    glm::vec2 normal;
+    float friction;
+    float invMassA;
+    float invMassB;
+    float invInertiaA;
+    float invInertiaB;
+    uint32_t pointCount;
+    ContactConstraintPoint points[2];
+    glm::mat2 K;          // 두 점 블록 솔버용 유효 질량 행렬과 역행렬
+    glm::mat2 normalMass;
+};
+
+// 같은 색의 제약 8 개를 레인별 SoA 로 묶은 것 (SSE2 는 4 레인씩 두 번)
+// 한 묶음 안의 제약은 동적 body 를 공유하지 않으므로 동시에 풀 수 있습니다.
+struct alignas(32) WideContactConstraint
+{
+    static constexpr uint32_t LaneCount = 8;
+
+    uint32_t index[LaneCount]; // m_Constraints 인덱스
+    uint32_t a[LaneCount];
+    uint32_t b[LaneCount];
+    float normalX[LaneCount];
+    float normalY[LaneCount];
+    float friction[LaneCount];
+    float invMassA[LaneCount];
+    float invMassB[LaneCount];
+    float invInertiaA[LaneCount];
+    float invInertiaB[LaneCount];
+    float pointCount[LaneCount];
+
+    float rAx[2][LaneCount];
+    float rAy[2][LaneCount];
+    float rBx[2][LaneCount];
+    float rBy[2][LaneCount];
+    float normalImpulse[2][LaneCount];
+    float tangentImpulse[2][LaneCount];
+    float normalMass[2][LaneCount];
+    float tangentMass[2][LaneCount];
+    float velocityBias[2][LaneCount];
+
+    // glm::mat2 와 같은 [열][행] 순서
+    float k00[LaneCount], k01[LaneCount], k10[LaneCount], k11[LaneCount];
+    float m00[LaneCount], m01[LaneCount], m10[LaneCount], m11[LaneCount];
+};
+
+// 누적 충격량 기반 순차 충격량(sequential impulse) 솔버
+// 호출자가 넘긴 ContactCache 에서 같은 body 쌍 / 가까운 접촉점의 지난
+// 충격량을 찾아 warm start 합니다.
+// 침투 보정은 속도에 섞지 않고(Baumgarte 없음) 위치 단계에서 따로 하므로
+// 쌓인 물체가 튀어 오르지 않습니다.
+//
+// Prepare 에서 제약 그래프를 색칠해 같은 색 안에서는 동적 body 를 공유하지
+// 않게 나누고, 색 단위로 작업 스레드와 SIMD 레인에 나눠 풉니다. 색 순서는
+// 고정이고 같은 색 안의 제약은 서로 독립이라, 결과는 스레드 수와 SIMD
+// 경로에 관계없이 비트 단위로 같습니다.
+class ContactSolver
+{
+public:
+    // 64 색을 넘는 제약은 마지막 묶음에서 호출 스레드가 순서대로 풉니다.
+    static constexpr uint32_t MaxColors = 64;
+
+    // contacts 는 (a, b) 사전순이어야 합니다.
+    // cache 가 nullptr 이거나 warm start 를 끄면 충격량 0 에서 시작합니다.
+    // cacheKeys[i] 는 contacts[i] 의 캐시 키이고, nullptr 이면 a, b 로
+    // 만든 키를 씁니다. (World 는 바뀌지 않는 body id 로 만든 키를 넘김)
+    void Prepare(const ContactManifold* contacts, uint32_t contactCount,
+                 const SolverBodies& bodies,
+                 const ContactCache* cache = nullptr,
+                 const uint64_t* cacheKeys = nullptr);
+    void WarmStart(const SolverBodies& bodies);
+    void SolveVelocities(const SolverBodies& bodies);
+    // SIMD 묶음의 누적 충격량을 제약 배열로 되돌립니다. (속도 반복 후 호출)
+    void StoreImpulses();
+    // 위치 적분 뒤 남은 침투를 위치/각도로 직접 보정합니다.
+    // 모든 침투가 허용 범위 안이면 true 를 반환합니다.
+    bool SolvePositions(const SolverBodies& bodies);
+
+    const std::vector<ContactConstraint>& GetConstraints() const
+    {
+        return m_Constraints;
+    }
+    // 마지막 Prepare 의 색 수 (넘친 제약 묶음 포함)
+    uint32_t GetColorCount() const
+    {
+        return static_cast<uint32_t>(m_Colors.size());
+    }
+
+    void SetWarmStarting(bool enabled) { m_WarmStarting = enabled; }
+    // nullptr 이면 호출 스레드에서만 풉니다.
+    void SetJobSystem(JobSystem* jobs) { m_JobSystem = jobs; }
+    void SetSimdLevel(SimdLevel level)
+    {
+        m_SimdLevel = level > MaxSimdLevel() ? MaxSimdLevel() : level;
+    }
+
+private:
+    // 한 색의 제약은 m_ColorOrder[first, first + count) 이고, 그중 앞의
+    // groupCount * 8 개는 m_Groups[firstGroup, ...) 로 묶여 SIMD 로 풉니다.
+    struct ColorBatch
+    {
+        uint32_t first;
+        uint32_t count;
+        uint32_t firstGroup;
+        uint32_t groupCount;
+        bool serial; // 색이 모자라 넘친 제약 (서로 body 를 공유할 수 있음)
+    };
+
+    static void MatchCachedImpulses(ContactConstraint& constraint,
+                                    const CachedContact& cached);
+    void BuildColors();
+    void PackGroup(WideContactConstraint& group,
+                   const uint32_t* indices) const;
+    static uint32_t ItemOffset(const ColorBatch& batch, uint32_t item);
+
+    // task(batch, slot, firstItem, lastItem) 를 색 순서대로 실행합니다.
+    // 항목 i < groupCount 는 SIMD 묶음, 나머지는 묶이지 않은 제약이며
+    // slot 은 한 색 안에서 겹치지 않는 작업 번호입니다.
+    template <typename Task>
+    void ForEachColor(const Task& task);
+
+private:
+    std::vector<ContactConstraint> m_Constraints;
+    bool m_WarmStarting = true;
+
+    JobSystem* m_JobSystem = nullptr;
+    SimdLevel m_SimdLevel = MaxSimdLevel();
+    SimdLevel m_GroupLevel = SimdLevel::Scalar; // m_Groups 를 만든 경로
+
+    std::vector<uint64_t> m_BodyColors; // body 별 사용 중인 색 비트
+    std::vector<uint8_t> m_ConstraintColors;
+    std::vector<uint32_t> m_ColorOrder; // 색 순서로 정렬한 제약 인덱스
+    std::vector<ColorBatch> m_Colors;
+    AlignedVector<WideContactConstraint> m_Groups;
+    std::vector<float> m_TaskSeparations;
+};
+
+} // namespace CitadelPhysicsEngine2D
@@ -0,0 +1,8 @@
+#pragma once
+
+#include "Body.h"
+#include "ContactCache.h"
+#include "ContactSolver.h"
+#include "ParticleSystem.h"
+#include "World.h"
+#include "WorldSnapshot.h"
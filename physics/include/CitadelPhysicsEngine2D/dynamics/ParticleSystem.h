@@ -0,0 +1,146 @@
+#pragma once
+
+#include <CitadelPhysicsEngine2D/broadphase/SpatialHashGrid.h>
+#include <CitadelPhysicsEngine2D/math/EngineMath.h>
+#include <CitadelPhysicsEngine2D/math/Simd.h>
+#include <CitadelPhysicsEngine2D/memory/AlignedAllocator.h>
+#include <CitadelPhysicsEngine2D/shapes/AABB.h>
+#include <CitadelPhysicsEngine2D/shapes/Circle.h>
+#include <CitadelPhysicsEngine2D/shapes/CircleSoA.h>
+#include <CitadelPhysicsEngine2D/shapes/OverlapPair.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace CitadelPhysicsEngine2D
+{
+
+struct ParticleArrays;
+
+struct ParticleDef
+{
+    glm::vec2 position = {0.0f, 0.0f};
+    glm::vec2 velocity = {0.0f, 0.0f};
+    float mass = 1.0f; // 0 이면 고정된 입자 (적분 / 보정에서 움직이지 않음)
+    float radius = 0.05f;
+};
+
+// 파편 / 로프 / 젤리용 XPBD 입자 시스템
+// 한 스텝을 substep 개로 나누고 substep 마다 적분 → 제약 한 번씩 투영
+// → 속도 갱신을 합니다. (small steps XPBD: 반복 대신 substep 을 늘리므로
+// λ 누적이 필요 없습니다.) 입자 상태는 SoA 배열이며, 적분 / 정적 도형
+// 충돌 / 속도 갱신은 입자 축으로 SIMD 레인에 나눠 처리합니다. SIMD 경로는
+// 스칼라 경로와 같은 순서로 연산하므로 결과가 비트 단위로 같습니다.
+//
+// 정적 도형(Circle, AABB)은 매 프레임 ClearColliders 후 다시 넣는 용도이고,
+// 입자끼리의 충돌은 켜면 스텝마다 SpatialHashGrid 로 후보 쌍을 찾습니다.
+class ParticleSystem
+{
+public:
+    explicit ParticleSystem(const glm::vec2& gravity = {0.0f, -9.8f});
+
+    uint32_t CreateParticle(const ParticleDef& def);
+    void Clear();
+    void Reserve(size_t capacity);
+
+    // 두 입자 사이 거리를 현재 거리로 유지합니다.
+    // compliance 는 XPBD 유연도(강성의 역수, m/N)이며 0 이면 늘어나지 않습니다.
+    uint32_t AddDistanceConstraint(uint32_t a, uint32_t b,
+                                   float compliance = 0.0f);
+    // 삼각형 (a, b, c) 의 부호 있는 넓이를 현재 넓이로 유지합니다.
+    uint32_t AddAreaConstraint(uint32_t a, uint32_t b, uint32_t c,
+                               float compliance = 0.0f);
+
+    // 입자가 들어가지 못하는 정적 도형
+    void AddCollider(const Circle& circle);
+    void AddCollider(const AABB& box);
+    void ClearColliders();
+
+    void Step(float dt);
+
+    uint32_t GetParticleCount() const
+    {
+        return static_cast<uint32_t>(m_PositionX.size());
+    }
+    glm::vec2 GetPosition(uint32_t index) const;
+    void SetPosition(uint32_t index, const glm::vec2& position);
+    glm::vec2 GetVelocity(uint32_t index) const;
+    void SetVelocity(uint32_t index, const glm::vec2& velocity);
+    float GetRadius(uint32_t index) const { return m_Radius[index]; }
+
+    // 렌더링용 위치 배열
+    const float* PositionX() const { return m_PositionX.data(); }
+    const float* PositionY() const { return m_PositionY.data(); }
+
+    void SetGravity(const glm::vec2& gravity) { m_Gravity = gravity; }
+    const glm::vec2& GetGravity() const { return m_Gravity; }
+    void SetSubsteps(uint32_t substeps) { m_Substeps = substeps; }
+    uint32_t GetSubsteps() const { return m_Substeps; }
+    // 정적 도형 접촉 시 접선 방향 이동을 줄이는 비율 [0, 1]
+    void SetFriction(float friction) { m_Friction = friction; }
+    void SetParticleCollisionEnabled(bool enabled)
+    {
+        m_ParticleCollision = enabled;
+    }
+    void SetSimdLevel(SimdLevel level)
+    {
+        m_SimdLevel = level > MaxSimdLevel() ? MaxSimdLevel() : level;
+    }
+
+    // 마지막 스텝의 입자 후보 쌍 (입자 충돌을 켠 경우)
+    const std::vector<OverlapPair>& GetParticlePairs() const
+    {
+        return m_ParticlePairs;
+    }
+
+private:
+    ParticleArrays GetArrays();
+    void FindParticlePairs(float dt);
+    void Integrate(float h);
+    void SolveDistanceConstraints(float h);
+    void SolveAreaConstraints(float h);
+    void SolveParticleContacts();
+    void SolveColliders();
+    void UpdateVelocities(float h);
+
+private:
+    glm::vec2 m_Gravity;
+    uint32_t m_Substeps = 4;
+    float m_Friction = 0.2f;
+    bool m_ParticleCollision = false;
+    SimdLevel m_SimdLevel = MaxSimdLevel();
+
+    // 입자 상태 (SoA)
+    AlignedVector<float> m_PositionX;
+    AlignedVector<float> m_PositionY;
+    AlignedVector<float> m_PreviousX; // substep 시작 위치
+    AlignedVector<float> m_PreviousY;
+    AlignedVector<float> m_VelocityX;
+    AlignedVector<float> m_VelocityY;
+    AlignedVector<float> m_InvMass;
+    AlignedVector<float> m_Radius;
+
+    // 거리 제약 (SoA)
+    std::vector<uint32_t> m_DistanceA;
+    std::vector<uint32_t> m_DistanceB;
+    std::vector<float> m_DistanceRest;
+    std::vector<float> m_DistanceCompliance;
+
+    // 넓이 제약 (SoA)
+    std::vector<uint32_t> m_AreaA;
+    std::vector<uint32_t> m_AreaB;
+    std::vector<uint32_t> m_AreaC;
+    std::vector<float> m_AreaRest;
+    std::vector<float> m_AreaCompliance;
+
+    // 정적 도형
+    CircleSoA m_CircleColliders;
+    std::vector<AABB> m_BoxColliders;
+
+    // 입자 충돌 broadphase (반지름을 스텝 이동량만큼 늘린 원으로 질의)
+    SpatialHashGrid m_Grid{0.0f};
+    CircleSoA m_SweptParticles;
+    std::vector<OverlapPair> m_ParticlePairs;
+};
+
+} // namespace CitadelPhysicsEngine2D
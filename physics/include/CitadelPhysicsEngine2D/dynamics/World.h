@@ -0,0 +1,268 @@
+#pragma once
+
+#include <CitadelPhysicsEngine2D/broadphase/DynamicTree.h>
+#include <CitadelPhysicsEngine2D/collision/CCD.h>
+#include <CitadelPhysicsEngine2D/collision/ContactManifold.h>
+#include <CitadelPhysicsEngine2D/dynamics/Body.h>
+#include <CitadelPhysicsEngine2D/dynamics/ContactCache.h>
+#include <CitadelPhysicsEngine2D/dynamics/ContactSolver.h>
+#include <CitadelPhysicsEngine2D/dynamics/WorldSnapshot.h>
+#include <CitadelPhysicsEngine2D/math/Transform2D.h>
+#include <CitadelPhysicsEngine2D/memory/AlignedAllocator.h>
+#include <CitadelPhysicsEngine2D/memory/FrameArena.h>
+#include <CitadelPhysicsEngine2D/memory/HandlePool.h>
+#include <CitadelPhysicsEngine2D/shapes/AABB.h>
+#include <CitadelPhysicsEngine2D/shapes/OverlapPair.h>
+#include <CitadelPhysicsEngine2D/shapes/Polygon.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace CitadelPhysicsEngine2D
+{
+
+// 마지막 Step 의 단계별 소요 시간 (밀리초)
+struct StepProfile
+{
+    float integrateVelocities = 0.0f; // 깨어 있는 body 를 앞으로 모으기 포함
+    float broadphase = 0.0f;
+    float collide = 0.0f;
+    float solveVelocities = 0.0f; // 접촉 캐시 갱신 + 속도 솔버
+    float continuous = 0.0f;      // CCD
+    float integratePositions = 0.0f;
+    float solvePositions = 0.0f;
+    float sleep = 0.0f; // 수면 판정 + 접촉 캐시 정리
+    float step = 0.0f;  // 전체
+};
+
+// 강체 시뮬레이션 월드
+// body 상태는 밀집 인덱스 [0, GetBodyCount()) 로 접근하는 SoA 배열에 빈틈
+// 없이 저장됩니다. body 를 제거하면 마지막 body 를 그 자리로 옮기고, Step
+// 을 시작할 때 깨어 있는 body 를 앞으로 모으므로 밀집 인덱스는 DestroyBody
+// 와 Step 때 바뀔 수 있습니다. 오래 들고 있을 때는 BodyHandle 을 씁니다.
+// (HandlePool)
+//
+// 접촉으로 이어진 동적 body 묶음(island)이 일정 시간 이상 멈춰 있으면
+// 함께 잠들고, 잠든 body 는 적분 / broadphase 이동 / 솔버에서 빠집니다.
+// 깨어 있는 body 와 닿거나 WakeBody 를 호출하면 island 전체가 깨어납니다.
+// 깨어 있는 동적 body 는 밀집 배열 앞쪽 [0, m_AwakeCount) 에 모여 있어
+// 적분 같은 반복은 인덱스 목록 없이 연속으로 돕니다.
+//
+// 같은 입력이면 스레드 풀 / SIMD 경로에 관계없이 결과가 비트 단위로 같습니다.
+// 접촉은 (a, b) 사전순으로 정렬된 뒤 풀리고, 병렬 단계는 고정된 순서로
+// 합쳐집니다. (CPE2D_DETERMINISTIC 빌드에서 FMA 축약 없음)
+class World
+{
+public:
+    explicit World(const glm::vec2& gravity = {0.0f, -9.8f});
+
+    BodyHandle CreateBody(const BodyDef& def);
+    void DestroyBody(BodyHandle handle);
+    bool IsValid(BodyHandle handle) const;
+
+    // integrate → broadphase → narrowphase → solve → integrate positions
+    // → position correction
+    void Step(float dt);
+
+    void SetGravity(const glm::vec2& gravity) { m_Gravity = gravity; }
+    const glm::vec2& GetGravity() const { return m_Gravity; }
+
+    glm::vec2 GetPosition(BodyHandle handle) const;
+    float GetAngle(BodyHandle handle) const;
+    Transform2D GetTransform(BodyHandle handle) const;
+    void SetTransform(BodyHandle handle, const glm::vec2& position,
+                      float angle);
+
+    glm::vec2 GetLinearVelocity(BodyHandle handle) const;
+    void SetLinearVelocity(BodyHandle handle, const glm::vec2& velocity);
+    float GetAngularVelocity(BodyHandle handle) const;
+    void SetAngularVelocity(BodyHandle handle, float velocity);
+    void ApplyLinearImpulse(BodyHandle handle, const glm::vec2& impulse,
+                            const glm::vec2& point);
+
+    uint32_t GetBodyCount() const { return m_Bodies.GetSize(); }
+    // 밀집 인덱스 (GetContacts 의 a, b) 의 body 핸들
+    BodyHandle GetBodyHandle(uint32_t index) const
+    {
+        return m_Bodies.GetHandle(index);
+    }
+
+    // 정적 body 는 항상 false
+    bool IsAwake(BodyHandle handle) const;
+    // body 가 속한 잠든 island 전체를 깨웁니다.
+    void WakeBody(BodyHandle handle);
+    uint32_t GetAwakeBodyCount() const { return m_AwakeBodyCount; }
+    // 끄면 모든 body 를 깨우고 이후 잠들지 않습니다.
+    void SetSleepingEnabled(bool enabled);
+
+    // body 핸들과 위치 / 각도 / 속도 / 수면 타이머의 비트 패턴으로 만든
+    // 64 비트 해시. lockstep 피어나 리플레이끼리 스텝마다 비교하면 전체
+    // 상태를 덤프하지 않고도 처음 어긋난 스텝을 찾을 수 있습니다.
+    uint64_t ComputeStateHash() const;
+    // 켜면 Step 끝마다 ComputeStateHash 를 계산해 GetStateHash 로 돌려줍니다.
+    void SetStateHashEnabled(bool enabled) { m_StateHashEnabled = enabled; }
+    uint64_t GetStateHash() const { return m_StateHash; }
+
+    // 롤백용 전체 상태 저장 / 복원
+    // body 배열, 수면 상태, broadphase 트리, 접촉과 warm start 캐시를 담으며
+    // 복원 뒤 Step 은 저장 시점에서 이어 간 Step 과 비트 단위로 같습니다.
+    // 중력, 반복 횟수, 스레드 풀 같은 설정은 담지 않습니다.
+    void SaveSnapshot(WorldSnapshot& snapshot) const;
+    void RestoreSnapshot(const WorldSnapshot& snapshot);
+
+    // 마지막 스텝의 접촉 (a, b 는 body 밀집 인덱스, (a, b) 사전순)
+    // 인덱스는 다음 Step / DestroyBody 전까지만 유효합니다.
+    const std::vector<ContactManifold>& GetContacts() const
+    {
+        return m_Contacts;
+    }
+    // 마지막 스텝에 닿기 시작한 / 떨어진 body 쌍 (BodyHandle::index, a < b)
+    // 잠든 채 닿아 있는 쌍은 끝나지 않은 것으로 봅니다. 깨어난 뒤 닿지 않고
+    // 멀어진 쌍의 끝 이벤트는 캐시 정리 단계에서 몇 스텝 늦게 나올 수 있습니다.
+    const std::vector<OverlapPair>& GetContactBeginEvents() const
+    {
+        return m_BeginEvents;
+    }
+    const std::vector<OverlapPair>& GetContactEndEvents() const
+    {
+        return m_EndEvents;
+    }
+    // body 쌍별 지난 접촉점과 충격량 (warm start / 이벤트용)
+    const ContactCache& GetContactCache() const { return m_ContactCache; }
+
+    // 스텝당 속도 반복 횟수 (warm start 덕분에 4~8 회면 충분)
+    void SetVelocityIterations(uint32_t iterations)
+    {
+        m_VelocityIterations = iterations;
+    }
+    uint32_t GetVelocityIterations() const { return m_VelocityIterations; }
+    void SetPositionIterations(uint32_t iterations)
+    {
+        m_PositionIterations = iterations;
+    }
+
+    // narrowphase 와 접촉 솔버를 나눠 실행할 작업 스케줄러
+    // (nullptr 이면 단일 스레드) 결과는 스레드 수와 관계없이 같습니다.
+    void SetJobSystem(JobSystem* jobs);
+
+    ContactSolver& GetContactSolver() { return m_Solver; }
+    const ContactSolver& GetContactSolver() const { return m_Solver; }
+
+    void SetCCDSettings(const CCDSettings& settings)
+    {
+        m_CCDSettings = settings;
+    }
+
+    const StepProfile& GetProfile() const { return m_Profile; }
+
+    // 스텝 임시 데이터용 arena (최고 사용량 / 넘친 횟수 확인용)
+    const FrameArena& GetFrameArena() const { return m_FrameArena; }
+
+private:
+    AABB ComputeAABB(uint32_t index) const;
+
+    void IntegrateVelocities(float dt);
+    void UpdateBroadphase(float dt);
+    void FindPairs(uint32_t firstAwake, AlignedVector<OverlapPair>& pairs);
+    void Collide();
+    bool CollidePair(uint32_t a, uint32_t b, ContactManifold& manifold,
+                     CachedContact* cache) const;
+    SolverBodies GetSolverBodies();
+    void UpdateContactCache();
+    void SolveContacts();
+    void SolveTimeOfImpacts(float dt);
+    void IntegratePositions(float dt);
+    void SolvePositions();
+    void UpdateSleep(float dt);
+    void SweepContactCache();
+    void WakeIsland(uint32_t index);
+    void AddWoken(uint32_t index);
+    void RemoveWoken(uint32_t index);
+    void CompactAwakeBodies();
+    void MoveBody(uint32_t from, uint32_t to);
+    void SwapBodies(uint32_t i, uint32_t j);
+    uint64_t MakeContactKey(uint32_t a, uint32_t b) const;
+    CachedContact& InsertContactEntry(uint64_t key);
+
+    // body 별 SoA 배열마다 function(array) 를 호출합니다.
+    // (크기 조정, swap-and-pop 이동, 스냅샷에 같은 목록을 씀)
+    template <typename Self, typename Function>
+    static void ForEachBodyArray(Self& self, Function&& function);
+
+private:
+    glm::vec2 m_Gravity;
+
+    // 핸들 → 밀집 인덱스
+    HandlePool<BodyHandle> m_Bodies;
+
+    // body 상태 (SoA, 밀집 인덱스)
+    AlignedVector<float> m_PositionX;
+    AlignedVector<float> m_PositionY;
+    AlignedVector<float> m_Angle;
+    AlignedVector<float> m_VelocityX;
+    AlignedVector<float> m_VelocityY;
+    AlignedVector<float> m_AngularVelocity;
+    AlignedVector<float> m_InvMass;
+    AlignedVector<float> m_InvInertia;
+    AlignedVector<float> m_GravityScale; // 정적 body 는 0
+
+    // 형상과 재질 (body 마다 형상 하나, body 와 함께 옮겨짐)
+    std::vector<ShapeType> m_Shape;
+    AlignedVector<float> m_Radius;
+    AlignedVector<float> m_HalfExtentX;
+    AlignedVector<float> m_HalfExtentY;
+    AlignedVector<float> m_Friction;
+    AlignedVector<float> m_Restitution;
+    std::vector<uint8_t> m_Bullet;
+    std::vector<Polygon> m_Polygon; // 상자의 로컬 다각형 (CreateBody 에서 한 번)
+
+    std::vector<uint32_t> m_ProxyId; // 트리 user data 는 밀집 인덱스
+
+    // 수면 상태
+    // Step 시작에 깨어 있는 동적 body 를 [0, m_AwakeCount) 로 모읍니다. 그
+    // 사이에 깨어난 body 는 m_WokenBodies 에, 잠든 body 는 m_Awake 만 0 이
+    // 된 채 제자리에 있다가 다음 Step 시작에 옮겨집니다.
+    // 잠든 island 의 body 들은 m_IslandNext / m_IslandPrev 로 원형 이중 연결
+    // 리스트를 이루어, body 를 옮길 때 이웃만 고치면 됩니다.
+    bool m_SleepingEnabled = true;
+    std::vector<uint8_t> m_Awake; // 정적 body 는 0
+    uint32_t m_AwakeCount = 0;
+    uint32_t m_AwakeBodyCount = 0;       // m_Awake 가 1 인 body 수
+    std::vector<uint32_t> m_WokenBodies; // 깨어 있지만 앞쪽 밖에 있는 body
+    std::vector<uint32_t> m_WokenSlot;   // m_WokenBodies 안의 위치
+    AlignedVector<float> m_SleepTime;
+    std::vector<uint32_t> m_IslandNext;
+    std::vector<uint32_t> m_IslandPrev;
+
+    bool m_StateHashEnabled = false;
+    uint64_t m_StateHash = 0;
+    StepProfile m_Profile;
+
+    DynamicTree m_Tree;
+    // Collide 도중 쌍을 찾은 body 의 질의 순번 + 1 (0 = 질의 안 함)
+    std::vector<uint32_t> m_PairsQueried;
+    std::vector<ContactManifold> m_Contacts;
+
+    // 접촉 캐시와 이벤트
+    uint32_t m_StepIndex = 0;
+    ContactCache m_ContactCache;
+    // m_Contacts 와 같은 순서의 캐시 키 (body id 쌍이라 이동해도 그대로)
+    std::vector<uint64_t> m_ContactKeys;
+    std::vector<uint64_t> m_PreviousContactKeys;
+    std::vector<OverlapPair> m_BeginEvents;
+    std::vector<OverlapPair> m_EndEvents;
+
+    JobSystem* m_JobSystem = nullptr;
+    ContactSolver m_Solver;
+    uint32_t m_VelocityIterations = 8;
+    uint32_t m_PositionIterations = 3;
+
+    CCDSettings m_CCDSettings;
+    std::vector<TOIEvent> m_TOIEvents;
+
+    // 쌍 목록, narrowphase 결과, island, CCD 입력 등 한 스텝 안에서만 쓰는
+    // 배열은 여기서 받고 스텝 끝에 한 번에 비웁니다.
+    FrameArena m_FrameArena;
+};
+
+} // namespace CitadelPhysicsEngine2D
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace CitadelPhysicsEngine2D
+{
+
+class World;
+
+// World::SaveSnapshot 이 채우는 연속 바이트 버퍼
+// 같은 스냅샷 객체에 다시 저장하면 버퍼를 재사용하므로, body 수가 늘지
+// 않는 한 저장은 배열별 memcpy 몇 번이고 할당이 없습니다.
+class WorldSnapshot
+{
+public:
+    size_t GetSize() const { return m_Data.size(); }
+    bool IsEmpty() const { return m_Data.empty(); }
+
+private:
+    friend class World;
+
+    std::vector<uint8_t> m_Data;
+};
+
+// 최근 capacity 프레임의 스냅샷을 보관하는 링 버퍼 (롤백 후 재시뮬레이션용)
+// 프레임 f 는 f % capacity 칸에 저장되어 capacity 프레임 전의 것을
+// 덮어씁니다.
+class WorldSnapshotRing
+{
+public:
+    static constexpr uint32_t InvalidFrame = 0xFFFFFFFFu;
+
+    explicit WorldSnapshotRing(uint32_t capacity);
+
+    void Save(const World& world, uint32_t frame);
+    // frame 의 스냅샷이 남아 있으면 복원하고 true 를 반환합니다.
+    bool Restore(World& world, uint32_t frame) const;
+    bool Contains(uint32_t frame) const;
+
+    uint32_t GetCapacity() const
+    {
+        return static_cast<uint32_t>(m_Snapshots.size());
+    }
+
+private:
+    std::vector<WorldSnapshot> m_Snapshots;
+    std::vector<uint32_t> m_Frames; // 칸별 저장된 프레임 (비었으면 Invalid)
+};
+
+} // namespace CitadelPhysicsEngine2D
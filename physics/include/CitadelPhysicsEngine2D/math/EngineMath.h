@@ -10,4 +10,10 @@
 
 #include <glm/gtc/matrix_transform.hpp>
 
+// 결정적 모드에서는 FMA 축약을 끄고 (CMake 의 -ffp-contract=off, /fp:precise)
+// 연산 순서를 바꾸는 fast-math 와 함께 빌드할 수 없습니다.
+#if defined(CPE2D_DETERMINISTIC) && defined(__FAST_MATH__)
+#error "CPE2D_DETERMINISTIC cannot be combined with -ffast-math"
+#endif
+
 #define M_PI 3.14159265358979323846
\ No newline at end of file
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+
+// 컴파일러가 활성화한 명령어 집합에 따라 SIMD 경로를 선택합니다.
+// AVX2는 CPE2D_ENABLE_AVX2 CMake 옵션(-mavx2, /arch:AVX2)으로 켭니다.
+#if defined(__AVX2__)
+#define CPE2D_SIMD_AVX2 1
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CPE2D_SIMD_SSE2 1
+#endif
+
+#if defined(CPE2D_SIMD_SSE2) || defined(CPE2D_SIMD_AVX2)
+#include <immintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace CitadelPhysicsEngine2D
+{
+
+enum class SimdLevel : uint8_t
+{
+    Scalar,
+    SSE2,
+    AVX2,
+};
+
+// 현재 빌드에서 사용 가능한 가장 넓은 SIMD 경로
+constexpr SimdLevel MaxSimdLevel()
+{
+#if defined(CPE2D_SIMD_AVX2)
+    return SimdLevel::AVX2;
+#elif defined(CPE2D_SIMD_SSE2)
+    return SimdLevel::SSE2;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+// v != 0 이어야 합니다.
+inline uint32_t CountTrailingZeros(uint32_t v)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, v);
+    return static_cast<uint32_t>(index);
+#else
+    return static_cast<uint32_t>(__builtin_ctz(v));
+#endif
+}
+
+inline uint32_t CountTrailingZeros(uint64_t v)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, v);
+    return static_cast<uint32_t>(index);
+#else
+    return static_cast<uint32_t>(__builtin_ctzll(v));
+#endif
+}
+
+inline uint32_t PopCount(uint32_t v)
+{
+#if defined(_MSC_VER)
+    return static_cast<uint32_t>(__popcnt(v));
+#else
+    return static_cast<uint32_t>(__builtin_popcount(v));
+#endif
+}
+
+} // namespace CitadelPhysicsEngine2D
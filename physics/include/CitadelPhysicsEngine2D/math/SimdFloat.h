@@ -0,0 +1,137 @@
+#pragma once
+
+#include <CitadelPhysicsEngine2D/math/Simd.h>
+
+#include <cstdint>
+
+namespace CitadelPhysicsEngine2D
+{
+
+// 레인 수만 다른 SIMD 커널을 템플릿 하나로 작성하기 위한 얇은 래퍼
+// 연산은 스칼라 코드와 같은 순서로 한 번씩만 수행되므로 (FMA 미사용)
+// 같은 식을 쓰면 스칼라 경로와 비트 단위로 같은 결과가 나옵니다.
+// 비교 결과(마스크)도 같은 타입에 비트 패턴으로 담습니다.
+
+#if defined(CPE2D_SIMD_SSE2)
+struct Float4
+{
+    static constexpr uint32_t Width = 4;
+    __m128 v;
+
+    static Float4 Zero() { return {_mm_setzero_ps()}; }
+    static Float4 Splat(float x) { return {_mm_set1_ps(x)}; }
+    static Float4 Load(const float* p) { return {_mm_loadu_ps(p)}; }
+    void Store(float* p) const { _mm_storeu_ps(p, v); }
+
+    static Float4 Gather(const float* base, const uint32_t* index)
+    {
+        return {_mm_setr_ps(base[index[0]], base[index[1]], base[index[2]],
+                            base[index[3]])};
+    }
+};
+
+inline Float4 operator+(Float4 a, Float4 b) { return {_mm_add_ps(a.v, b.v)}; }
+inline Float4 operator-(Float4 a, Float4 b) { return {_mm_sub_ps(a.v, b.v)}; }
+inline Float4 operator*(Float4 a, Float4 b) { return {_mm_mul_ps(a.v, b.v)}; }
+inline Float4 operator/(Float4 a, Float4 b) { return {_mm_div_ps(a.v, b.v)}; }
+// 부호 비트만 뒤집어 스칼라의 단항 - 와 같게 만듭니다. (0 - x 와 다름)
+inline Float4 operator-(Float4 a)
+{
+    return {_mm_xor_ps(a.v, _mm_set1_ps(-0.0f))};
+}
+
+// std::min / std::max 와 같게 두 값이 같으면 (±0) 첫 인자를 돌려줍니다.
+inline Float4 Min(Float4 a, Float4 b) { return {_mm_min_ps(b.v, a.v)}; }
+inline Float4 Max(Float4 a, Float4 b) { return {_mm_max_ps(b.v, a.v)}; }
+inline Float4 Sqrt(Float4 a) { return {_mm_sqrt_ps(a.v)}; }
+
+inline Float4 Less(Float4 a, Float4 b) { return {_mm_cmplt_ps(a.v, b.v)}; }
+inline Float4 GreaterEqual(Float4 a, Float4 b)
+{
+    return {_mm_cmpge_ps(a.v, b.v)};
+}
+inline Float4 And(Float4 a, Float4 b) { return {_mm_and_ps(a.v, b.v)}; }
+inline Float4 Or(Float4 a, Float4 b) { return {_mm_or_ps(a.v, b.v)}; }
+inline Float4 AndNot(Float4 mask, Float4 b)
+{
+    return {_mm_andnot_ps(mask.v, b.v)};
+}
+// mask ? a : b
+inline Float4 Select(Float4 mask, Float4 a, Float4 b)
+{
+    return {_mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v))};
+}
+inline uint32_t MoveMask(Float4 mask)
+{
+    return static_cast<uint32_t>(_mm_movemask_ps(mask.v));
+}
+#endif
+
+#if defined(CPE2D_SIMD_AVX2)
+struct Float8
+{
+    static constexpr uint32_t Width = 8;
+    __m256 v;
+
+    static Float8 Zero() { return {_mm256_setzero_ps()}; }
+    static Float8 Splat(float x) { return {_mm256_set1_ps(x)}; }
+    static Float8 Load(const float* p) { return {_mm256_loadu_ps(p)}; }
+    void Store(float* p) const { _mm256_storeu_ps(p, v); }
+
+    static Float8 Gather(const float* base, const uint32_t* index)
+    {
+        __m256i i = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(index));
+        return {_mm256_i32gather_ps(base, i, 4)};
+    }
+};
+
+inline Float8 operator+(Float8 a, Float8 b)
+{
+    return {_mm256_add_ps(a.v, b.v)};
+}
+inline Float8 operator-(Float8 a, Float8 b)
+{
+    return {_mm256_sub_ps(a.v, b.v)};
+}
+inline Float8 operator*(Float8 a, Float8 b)
+{
+    return {_mm256_mul_ps(a.v, b.v)};
+}
+inline Float8 operator/(Float8 a, Float8 b)
+{
+    return {_mm256_div_ps(a.v, b.v)};
+}
+inline Float8 operator-(Float8 a)
+{
+    return {_mm256_xor_ps(a.v, _mm256_set1_ps(-0.0f))};
+}
+
+inline Float8 Min(Float8 a, Float8 b) { return {_mm256_min_ps(b.v, a.v)}; }
+inline Float8 Max(Float8 a, Float8 b) { return {_mm256_max_ps(b.v, a.v)}; }
+inline Float8 Sqrt(Float8 a) { return {_mm256_sqrt_ps(a.v)}; }
+
+inline Float8 Less(Float8 a, Float8 b)
+{
+    return {_mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ)};
+}
+inline Float8 GreaterEqual(Float8 a, Float8 b)
+{
+    return {_mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ)};
+}
+inline Float8 And(Float8 a, Float8 b) { return {_mm256_and_ps(a.v, b.v)}; }
+inline Float8 Or(Float8 a, Float8 b) { return {_mm256_or_ps(a.v, b.v)}; }
+inline Float8 AndNot(Float8 mask, Float8 b)
+{
+    return {_mm256_andnot_ps(mask.v, b.v)};
+}
+inline Float8 Select(Float8 mask, Float8 a, Float8 b)
+{
+    return {_mm256_blendv_ps(b.v, a.v, mask.v)};
+}
+inline uint32_t MoveMask(Float8 mask)
+{
+    return static_cast<uint32_t>(_mm256_movemask_ps(mask.v));
+}
+#endif
+
+} // namespace CitadelPhysicsEngine2D
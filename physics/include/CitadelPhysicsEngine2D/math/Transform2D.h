@@ -0,0 +1,41 @@
+#pragma once
+
+#include <CitadelPhysicsEngine2D/math/EngineMath.h>
+
+#include <cmath>
+
+namespace CitadelPhysicsEngine2D
+{
+
+// 2D 강체 변환 (회전 후 이동). 회전은 (cos, sin) 으로 저장합니다.
+struct Transform2D
+{
+    glm::vec2 position = {0.0f, 0.0f};
+    glm::vec2 rotation = {1.0f, 0.0f};
+
+    Transform2D() = default;
+    Transform2D(const glm::vec2& position, float angle)
+        : position(position), rotation(std::cos(angle), std::sin(angle))
+    {
+    }
+
+    glm::vec2 Rotate(const glm::vec2& v) const
+    {
+        return {rotation.x * v.x - rotation.y * v.y,
+                rotation.y * v.x + rotation.x * v.y};
+    }
+
+    glm::vec2 InvRotate(const glm::vec2& v) const
+    {
+        return {rotation.x * v.x + rotation.y * v.y,
+                -rotation.y * v.x + rotation.x * v.y};
+    }
+
+    glm::vec2 Apply(const glm::vec2& v) const { return Rotate(v) + position; }
+    glm::vec2 ApplyInverse(const glm::vec2& v) const
+    {
+        return InvRotate(v - position);
+    }
+};
+
+} // namespace CitadelPhysicsEngine2D
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <CitadelPhysicsEngine2D/memory/StackArena.h>
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace CitadelPhysicsEngine2D
+{
+
+// SoA 배열을 SIMD 레지스터 폭에 맞춰 정렬하기 위한 std 할당자
+// arena 를 주면 그 StackArena 에서 할당하고 해제는 하지 않습니다.
+// (스텝 임시 배열용. arena 가 Reset 되기 전에 컨테이너를 버려야 합니다.)
+template <typename T, std::size_t Alignment = 32>
+struct AlignedAllocator
+{
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() = default;
+    explicit AlignedAllocator(StackArena* arena) : arena(arena) {}
+
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>& other)
+        : arena(other.arena)
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+        if (arena != nullptr)
+            return static_cast<T*>(arena->Allocate(n * sizeof(T), Alignment));
+        return static_cast<T*>(
+            ::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+    }
+
+    void deallocate(T* p, std::size_t)
+    {
+        if (arena == nullptr)
+            ::operator delete(p, std::align_val_t(Alignment));
+    }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>& other) const
+    {
+        return arena == other.arena;
+    }
+
+    template <typename U>
+    bool operator!=(const AlignedAllocator<U, Alignment>& other) const
+    {
+        return arena != other.arena;
+    }
+
+    StackArena* arena = nullptr;
+};
+
+template <typename T>
+using AlignedVector = std::vector<T, AlignedAllocator<T>>;
+
+// arena 에서 할당하는 빈 AlignedVector
+template <typename T>
+AlignedVector<T> MakeArenaVector(StackArena& arena)
+{
+    return AlignedVector<T>(AlignedAllocator<T>(&arena));
+}
+
+} // namespace CitadelPhysicsEngine2D
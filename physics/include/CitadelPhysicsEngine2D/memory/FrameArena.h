@@ -0,0 +1,51 @@
+#pragma once
+
+#include <CitadelPhysicsEngine2D/memory/StackArena.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace CitadelPhysicsEngine2D
+{
+
+// 스텝 하나의 임시 데이터용 arena 묶음
+// 호출 스레드용 주 arena 와, 병렬 작업이 잠금 없이 쓰도록 스레드마다
+// 하나씩 둔 하위 arena 로 이루어집니다. 하위 arena 번호는
+// JobSystem::GetCurrentThreadIndex 이고, 작업 스레드가 아닌 스레드는 모두
+// 0 번이므로 0 번은 스텝을 부른 스레드만 씁니다. 스텝이 끝나면 Reset 으로
+// 한 번에 비우므로 여기서 받은 메모리는 스텝 밖으로 가지고 나가면 안 됩니다.
+class FrameArena
+{
+public:
+    explicit FrameArena(size_t capacity = 64 * 1024);
+
+    // 하위 arena 수 (작업 스케줄러의 스레드 수)
+    void SetThreadCount(uint32_t count);
+    uint32_t GetThreadCount() const
+    {
+        return static_cast<uint32_t>(m_ThreadArenas.size());
+    }
+
+    StackArena& GetMain() { return m_Main; }
+    StackArena& GetThreadArena(uint32_t threadIndex)
+    {
+        return *m_ThreadArenas[threadIndex];
+    }
+
+    void Reset();
+
+    // 모든 arena 의 최고 사용량 합
+    size_t GetHighWaterMark() const;
+    // 모든 arena 가 전역 할당자를 부른 횟수 합 (정상 상태에서는 늘지 않음)
+    uint32_t GetOverflowCount() const;
+
+private:
+    size_t m_Capacity;
+    StackArena m_Main;
+    // 스레드끼리 같은 캐시 라인을 건드리지 않도록 따로 할당
+    std::vector<std::unique_ptr<StackArena>> m_ThreadArenas;
+};
+
+} // namespace CitadelPhysicsEngine2D
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <CitadelPhysicsEngine2D/memory/SnapshotBuffer.h>
+
+#include <cassert>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace CitadelPhysicsEngine2D
+{
+
+// 세대 핸들을 밀집 인덱스로 바꿔 주는 풀
+// 핸들의 index 는 바뀌지 않는 id 이고, 항목 데이터는 호출자의 SoA 배열에
+// [0, GetSize()) 밀집 인덱스로 빈틈 없이 저장합니다. 제거하면 마지막 항목을
+// 빈자리로 옮기고(swap-and-pop) 줄이므로 살아 있는 항목만 연속으로 돌 수
+// 있습니다. 생성 / 제거 / 조회는 모두 O(1) 입니다.
+//
+// 제거된 id 는 세대를 올려 free list 에 넣고 다음 Create 에서 재사용하므로
+// 이전 핸들은 IsValid 가 false 가 됩니다.
+//
+// Handle 은 uint32_t index / generation 멤버를 가진 타입입니다. (BodyHandle)
+template <typename Handle>
+class HandlePool
+{
+public:
+    static constexpr uint32_t InvalidIndex = 0xFFFFFFFFu;
+
+    // 새 항목의 밀집 인덱스는 GetSize() - 1 입니다.
+    Handle Create()
+    {
+        uint32_t id;
+        if (m_FreeHead != InvalidIndex)
+        {
+            id = m_FreeHead;
+            m_FreeHead = m_Sparse[id];
+        }
+        else
+        {
+            id = static_cast<uint32_t>(m_Sparse.size());
+            m_Sparse.push_back(InvalidIndex);
+            m_Generation.push_back(0);
+        }
+        m_Sparse[id] = static_cast<uint32_t>(m_Dense.size());
+        m_Dense.push_back(id);
+
+        Handle handle;
+        handle.index = id;
+        handle.generation = m_Generation[id];
+        return handle;
+    }
+
+    // 항목을 지우고 그 밀집 인덱스를 반환합니다. 반환값이 새 GetSize() 와
+    // 다르면 마지막 항목(밀집 인덱스 GetSize())이 그 자리로 옮겨졌으므로
+    // 호출자도 SoA 배열에서 같은 이동을 해야 합니다.
+    uint32_t Destroy(Handle handle)
+    {
+        assert(IsValid(handle));
+        const uint32_t id = handle.index;
+        const uint32_t dense = m_Sparse[id];
+        const uint32_t last = m_Dense.back();
+        m_Dense[dense] = last;
+        m_Sparse[last] = dense;
+        m_Dense.pop_back();
+
+        ++m_Generation[id];
+        m_Sparse[id] = m_FreeHead;
+        m_FreeHead = id;
+        return dense;
+    }
+
+    // 두 밀집 인덱스의 항목을 맞바꿉니다. (호출자도 SoA 배열을 맞바꿈)
+    void Swap(uint32_t denseA, uint32_t denseB)
+    {
+        std::swap(m_Dense[denseA], m_Dense[denseB]);
+        m_Sparse[m_Dense[denseA]] = denseA;
+        m_Sparse[m_Dense[denseB]] = denseB;
+    }
+
+    bool IsValid(Handle handle) const
+    {
+        return IsValid(handle.index, handle.generation);
+    }
+    bool IsValid(uint32_t id, uint32_t generation) const
+    {
+        return id < m_Generation.size() && m_Generation[id] == generation &&
+               IsAlive(id);
+    }
+
+    uint32_t GetDenseIndex(Handle handle) const
+    {
+        assert(IsValid(handle));
+        return m_Sparse[handle.index];
+    }
+    // 살아 있지 않은 id 면 InvalidIndex
+    uint32_t GetDenseIndex(uint32_t id, uint32_t generation) const
+    {
+        return IsValid(id, generation) ? m_Sparse[id] : InvalidIndex;
+    }
+
+    Handle GetHandle(uint32_t dense) const
+    {
+        Handle handle;
+        handle.index = m_Dense[dense];
+        handle.generation = m_Generation[handle.index];
+        return handle;
+    }
+    uint32_t GetId(uint32_t dense) const { return m_Dense[dense]; }
+    uint32_t GetGeneration(uint32_t id) const { return m_Generation[id]; }
+
+    uint32_t GetSize() const { return static_cast<uint32_t>(m_Dense.size()); }
+    // 지금까지 만든 id 수 (id 는 [0, GetIdCount()))
+    uint32_t GetIdCount() const
+    {
+        return static_cast<uint32_t>(m_Sparse.size());
+    }
+
+    void SaveState(SnapshotWriter& writer) const
+    {
+        writer.WriteArray(m_Dense);
+        writer.WriteArray(m_Sparse);
+        writer.WriteArray(m_Generation);
+        writer.Write(m_FreeHead);
+    }
+    void RestoreState(SnapshotReader& reader)
+    {
+        reader.ReadArray(m_Dense);
+        reader.ReadArray(m_Sparse);
+        reader.ReadArray(m_Generation);
+        reader.Read(m_FreeHead);
+    }
+
+private:
+    bool IsAlive(uint32_t id) const
+    {
+        const uint32_t dense = m_Sparse[id];
+        return dense < m_Dense.size() && m_Dense[dense] == id;
+    }
+
+private:
+    std::vector<uint32_t> m_Dense;      // 밀집 인덱스 → id
+    std::vector<uint32_t> m_Sparse;     // id → 밀집 인덱스 (빈 id 는 다음 빈 id)
+    std::vector<uint32_t> m_Generation; // id 별 세대
+    uint32_t m_FreeHead = InvalidIndex;
+};
+
+} // namespace CitadelPhysicsEngine2D
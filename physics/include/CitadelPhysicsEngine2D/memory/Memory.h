@@ -0,0 +1,7 @@
+#pragma once
+
+#include "AlignedAllocator.h"
+#include "FrameArena.h"
+#include "HandlePool.h"
+#include "SnapshotBuffer.h"
+#include "StackArena.h"
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace CitadelPhysicsEngine2D
+{
+
+// 스냅샷용 연속 바이트 버퍼에 값과 배열을 순서대로 이어 씁니다.
+// 배열은 원소 수 다음에 원소 바이트를 그대로 memcpy 하므로 원소 타입은
+// trivially copyable 이어야 합니다. 버퍼를 재사용하면 용량이 유지되어
+// 같은 크기의 상태를 다시 저장할 때 할당이 없습니다.
+class SnapshotWriter
+{
+public:
+    explicit SnapshotWriter(std::vector<uint8_t>& buffer) : m_Buffer(buffer)
+    {
+    }
+
+    template <typename T>
+    void Write(const T& value)
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "snapshot values must be trivially copyable");
+        WriteBytes(&value, sizeof(T));
+    }
+
+    template <typename Container>
+    void WriteArray(const Container& values)
+    {
+        using T = typename Container::value_type;
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "snapshot arrays must be trivially copyable");
+        Write(static_cast<uint32_t>(values.size()));
+        WriteBytes(values.data(), values.size() * sizeof(T));
+    }
+
+private:
+    void WriteBytes(const void* data, size_t size)
+    {
+        if (size == 0)
+            return;
+        const size_t offset = m_Buffer.size();
+        m_Buffer.resize(offset + size);
+        std::memcpy(m_Buffer.data() + offset, data, size);
+    }
+
+private:
+    std::vector<uint8_t>& m_Buffer;
+};
+
+// SnapshotWriter 가 쓴 순서 그대로 읽어 값과 배열을 복원합니다.
+// 배열은 resize 후 memcpy 하므로 용량이 충분하면 할당이 없습니다.
+class SnapshotReader
+{
+public:
+    SnapshotReader(const uint8_t* data, size_t size)
+        : m_Cursor(data), m_End(data + size)
+    {
+    }
+
+    template <typename T>
+    void Read(T& value)
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "snapshot values must be trivially copyable");
+        ReadBytes(&value, sizeof(T));
+    }
+
+    template <typename Container>
+    void ReadArray(Container& values)
+    {
+        using T = typename Container::value_type;
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "snapshot arrays must be trivially copyable");
+        uint32_t count = 0;
+        Read(count);
+        values.resize(count);
+        ReadBytes(values.data(), size_t(count) * sizeof(T));
+    }
+
+    bool IsAtEnd() const { return m_Cursor == m_End; }
+
+private:
+    void ReadBytes(void* data, size_t size)
+    {
+        if (size == 0)
+            return;
+        assert(size <= size_t(m_End - m_Cursor) && "snapshot is truncated");
+        std::memcpy(data, m_Cursor, size);
+        m_Cursor += size;
+    }
+
+private:
+    const uint8_t* m_Cursor;
+    const uint8_t* m_End;
+};
+
+} // namespace CitadelPhysicsEngine2D
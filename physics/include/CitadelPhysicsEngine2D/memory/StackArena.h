@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace CitadelPhysicsEngine2D
+{
+
+// 한 스텝 동안만 쓰는 임시 데이터용 선형(bump) 할당기
+// 연속 버퍼 하나에서 포인터만 밀어 할당하고 개별 해제는 하지 않습니다.
+// 버퍼가 모자라면 넘친 만큼만 전역 할당자에서 따로 받고, Reset 때 최고
+// 사용량에 맞춰 버퍼를 한 번 키우므로 같은 크기의 스텝이 반복되면 전역
+// 할당자 호출이 없어집니다.
+//
+// 스레드 안전하지 않습니다. 스레드마다 따로 두고 씁니다. (FrameArena)
+class StackArena
+{
+public:
+    explicit StackArena(size_t capacity = 0);
+    ~StackArena();
+
+    StackArena(const StackArena&) = delete;
+    StackArena& operator=(const StackArena&) = delete;
+
+    void* Allocate(size_t size, size_t alignment);
+
+    // 생성자를 부르지 않으므로 trivially constructible 타입용입니다.
+    template <typename T>
+    T* Allocate(size_t count)
+    {
+        return static_cast<T*>(Allocate(count * sizeof(T), alignof(T)));
+    }
+
+    // 마커 이후의 할당을 되돌립니다. (넘친 할당은 Reset 때 해제)
+    size_t GetMarker() const { return m_Used; }
+    void FreeToMarker(size_t marker);
+
+    // 모든 할당을 해제합니다. 이전 Reset 이후 넘친 적이 있으면 최고
+    // 사용량보다 조금 크게 버퍼를 다시 잡습니다.
+    void Reset();
+
+    size_t GetUsed() const { return m_Used + m_OverflowBytes; }
+    size_t GetCapacity() const { return m_Capacity; }
+    // 생성 이후 한 번에 가장 많이 쓴 바이트 수
+    size_t GetHighWaterMark() const { return m_HighWaterMark; }
+    // 생성 이후 버퍼가 모자라 전역 할당자를 부른 횟수
+    uint32_t GetOverflowCount() const { return m_OverflowCount; }
+
+private:
+    uint8_t* m_Buffer = nullptr;
+    size_t m_Capacity = 0;
+    size_t m_Used = 0;
+    size_t m_HighWaterMark = 0;
+
+    std::vector<void*> m_Overflow;
+    size_t m_OverflowBytes = 0;
+    uint32_t m_OverflowCount = 0;
+};
+
+} // namespace CitadelPhysicsEngine2D
@@ -0,0 +1,157 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+// 프로파일링 구역
+// CPE2D_PROFILING 빌드(CMake 옵션 CPE2D_ENABLE_PROFILING)에서만 코드가
+// 생기고, 아니면 빈 문장이 되어 비용이 없습니다. name 은 문자열 리터럴처럼
+// 캡처를 내보낼 때까지 살아 있는 문자열이어야 합니다. (포인터만 저장)
+//
+//     void World::Collide()
+//     {
+//         CPE2D_PROFILE_SCOPE("World::Collide");
+//         ...
+//     }
+#if defined(CPE2D_PROFILING)
+#define CPE2D_PROFILE_CONCAT_INNER(a, b) a##b
+#define CPE2D_PROFILE_CONCAT(a, b) CPE2D_PROFILE_CONCAT_INNER(a, b)
+#define CPE2D_PROFILE_SCOPE(name)                                              \
+    ::CitadelPhysicsEngine2D::ProfileScope CPE2D_PROFILE_CONCAT(               \
+        cpe2dProfileScope, __LINE__)(name)
+#define CPE2D_PROFILE_THREAD_NAME(name)                                        \
+    ::CitadelPhysicsEngine2D::Profiler::SetThreadName(name)
+#else
+#define CPE2D_PROFILE_SCOPE(name) ((void)0)
+#define CPE2D_PROFILE_THREAD_NAME(name) ((void)0)
+#endif
+
+namespace CitadelPhysicsEngine2D
+{
+
+struct ProfileEvent
+{
+    const char* name;
+    uint64_t begin; // Profiler::ReadClock 틱
+    uint64_t end;
+};
+
+// 스레드 하나의 이벤트 버퍼
+// 그 스레드만 Push 하므로 잠금이 없습니다. 가득 차면 새 이벤트는 버리고
+// 버린 수만 셉니다.
+class ProfileThreadBuffer
+{
+public:
+    void Push(const char* name, uint64_t begin, uint64_t end)
+    {
+        const uint32_t count = m_Count.load(std::memory_order_relaxed);
+        if (count >= m_Capacity)
+        {
+            m_Dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        m_Events[count] = {name, begin, end};
+        m_Count.store(count + 1, std::memory_order_release);
+    }
+
+private:
+    friend class Profiler;
+
+    std::unique_ptr<ProfileEvent[]> m_Events;
+    uint32_t m_Capacity = 0;
+    std::atomic<uint32_t> m_Count{0};
+    std::atomic<uint64_t> m_Dropped{0};
+    const char* m_Name = nullptr;
+    uint32_t m_ThreadId = 0; // 등록 순서
+};
+
+// 구역 이벤트를 모아 Chrome trace-event JSON 으로 내보내는 전역 프로파일러
+// 스레드마다 처음 이벤트를 남길 때 버퍼를 등록하고, 이후에는 그 스레드의
+// 버퍼에만 기록합니다. 시계는 x86 에서 rdtsc 이고, 캡처 시작 / 끝의
+// steady_clock 시각으로 틱을 마이크로초로 바꿉니다.
+//
+// BeginCapture / EndCapture / WriteChromeTrace 는 다른 스레드가 구역을
+// 기록하고 있지 않을 때(프레임 사이) 호출합니다. 작업 스레드는 프레임이
+// 끝나면 모두 Wait 로 합류하므로 앱의 메인 루프에서 부르면 됩니다.
+class Profiler
+{
+public:
+    static constexpr uint32_t ThreadEventCapacity = 1u << 16;
+
+    static uint64_t ReadClock()
+    {
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return static_cast<uint64_t>(
+            std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    }
+
+    static bool IsCapturing()
+    {
+        return s_Capturing.load(std::memory_order_relaxed);
+    }
+
+    // 이전 캡처의 이벤트를 지우고 기록을 시작합니다.
+    static void BeginCapture();
+    static void EndCapture();
+
+    // Chrome (chrome://tracing, Perfetto) 에서 여는 trace-event JSON
+    // 마지막 캡처의 이벤트를 씁니다.
+    static void WriteChromeTrace(std::ostream& out);
+    static uint32_t GetEventCount();
+    // 버퍼가 가득 차 버린 이벤트 수
+    static uint64_t GetDroppedEventCount();
+
+    // 호출 스레드의 trace 이름 (name 은 계속 살아 있어야 함)
+    static void SetThreadName(const char* name);
+
+    static ProfileThreadBuffer& GetThreadBuffer();
+
+private:
+    static std::atomic<bool> s_Capturing;
+};
+
+// 생성부터 소멸까지를 구역 하나로 기록합니다. (CPE2D_PROFILE_SCOPE)
+// 캡처 중이 아니면 플래그 하나만 확인합니다.
+class ProfileScope
+{
+public:
+    explicit ProfileScope(const char* name)
+    {
+        if (Profiler::IsCapturing())
+        {
+            m_Name = name;
+            m_Begin = Profiler::ReadClock();
+        }
+    }
+
+    ~ProfileScope()
+    {
+        if (m_Name != nullptr)
+        {
+            const uint64_t end = Profiler::ReadClock();
+            Profiler::GetThreadBuffer().Push(m_Name, m_Begin, end);
+        }
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* m_Name = nullptr;
+    uint64_t m_Begin = 0;
+};
+
+} // namespace CitadelPhysicsEngine2D
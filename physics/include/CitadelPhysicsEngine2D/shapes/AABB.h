@@ -13,6 +13,10 @@ struct AABB
     AABB() = default;
     AABB(const glm::vec2& min, const glm::vec2& max) : min(min), max(max) {}
 
+    float GetPerimeter() const;
+    bool Contains(const AABB& other) const;
+
+    static AABB Combine(const AABB& a, const AABB& b);
     static bool AABBvsAABB(const AABB& a, const AABB& b);
 };
 
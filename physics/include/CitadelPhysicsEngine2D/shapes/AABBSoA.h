@@ -0,0 +1,68 @@
+#pragma once
+
+#include <CitadelPhysicsEngine2D/math/Simd.h>
+#include <CitadelPhysicsEngine2D/memory/AlignedAllocator.h>
+#include <CitadelPhysicsEngine2D/shapes/AABB.h>
+#include <CitadelPhysicsEngine2D/shapes/OverlapPair.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace CitadelPhysicsEngine2D
+{
+
+// AABB 배열을 축별 배열(minX/minY/maxX/maxY)로 저장하는 컨테이너
+// 배치 질의 결과는 AABB::AABBvsAABB 와 같은 판정(경계 접촉 포함)을 사용하며,
+// 모든 SIMD 경로는 스칼라 경로와 비트 단위로 동일한 결과를 냅니다.
+class AABBSoA
+{
+public:
+    AABBSoA() = default;
+    // 스텝 임시 배열용: arena 에서 할당 (arena 가 Reset 되기 전에 버려야 함)
+    explicit AABBSoA(StackArena* arena);
+
+    uint32_t Add(const AABB& box);
+    void Set(uint32_t index, const AABB& box);
+    AABB Get(uint32_t index) const;
+
+    void Reserve(size_t capacity);
+    void Clear();
+    uint32_t Size() const { return static_cast<uint32_t>(m_MinX.size()); }
+
+    const float* MinX() const { return m_MinX.data(); }
+    const float* MinY() const { return m_MinY.data(); }
+    const float* MaxX() const { return m_MaxX.data(); }
+    const float* MaxY() const { return m_MaxY.data(); }
+
+public:
+    // outMask 는 (Size() + 31) / 32 개의 워드가 필요합니다. (비트 1 = 충돌)
+    uint32_t QueryOverlapMask(const AABB& query, uint32_t* outMask,
+                              SimdLevel level = MaxSimdLevel()) const;
+
+    // outIndices 는 최대 Size() 개의 인덱스를 담을 수 있어야 합니다.
+    uint32_t QueryOverlapIndices(const AABB& query, uint32_t* outIndices,
+                                 SimdLevel level = MaxSimdLevel()) const;
+
+    // this[a] 와 other[b] 가 충돌하는 모든 쌍을 outPairs 뒤에 추가합니다.
+    void QueryOverlapPairs(const AABBSoA& other,
+                           std::vector<OverlapPair>& outPairs,
+                           SimdLevel level = MaxSimdLevel()) const;
+
+    // 컨테이너 내부의 a < b 인 모든 충돌 쌍을 outPairs 뒤에 추가합니다.
+    void QuerySelfOverlapPairs(std::vector<OverlapPair>& outPairs,
+                               SimdLevel level = MaxSimdLevel()) const;
+
+    // [first, last) 범위만 검사하는 저수준 질의 (pair 생성기에서 사용)
+    void QueryOverlapRange(const AABB& query, uint32_t first, uint32_t last,
+                           uint32_t queryIndex,
+                           std::vector<OverlapPair>& outPairs,
+                           SimdLevel level = MaxSimdLevel()) const;
+
+private:
+    AlignedVector<float> m_MinX;
+    AlignedVector<float> m_MinY;
+    AlignedVector<float> m_MaxX;
+    AlignedVector<float> m_MaxY;
+};
+
+} // namespace CitadelPhysicsEngine2D
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <CitadelPhysicsEngine2D/math/EngineMath.h>
+#include <CitadelPhysicsEngine2D/shapes/AABB.h>
 
 namespace CitadelPhysicsEngine2D
 {
@@ -15,6 +16,8 @@ struct Circle
     {
     }
 
+    AABB GetAABB() const;
+
     static bool CirclevsCircle(const Circle& a, const Circle& b);
 };
 
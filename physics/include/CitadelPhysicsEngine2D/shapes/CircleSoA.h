@@ -0,0 +1,62 @@
+#pragma once
+
+#include <CitadelPhysicsEngine2D/math/Simd.h>
+#include <CitadelPhysicsEngine2D/memory/AlignedAllocator.h>
+#include <CitadelPhysicsEngine2D/shapes/Circle.h>
+#include <CitadelPhysicsEngine2D/shapes/OverlapPair.h>
+
+#include <cstdint>
+
+namespace CitadelPhysicsEngine2D
+{
+
+// 원 배열을 x/y/radius 정렬 배열로 저장하는 컨테이너
+// 판정은 Circle::CirclevsCircle 과 동일(경계 접촉 포함)하며,
+// 질의 함수는 호출자가 넘긴 버퍼에만 기록하고 힙 할당을 하지 않습니다.
+class CircleSoA
+{
+public:
+    CircleSoA() = default;
+    // 스텝 임시 배열용: arena 에서 할당 (arena 가 Reset 되기 전에 버려야 함)
+    explicit CircleSoA(StackArena* arena);
+
+    uint32_t Add(const Circle& circle);
+    void Set(uint32_t index, const Circle& circle);
+    Circle Get(uint32_t index) const;
+
+    void Reserve(size_t capacity);
+    void Clear();
+    uint32_t Size() const { return static_cast<uint32_t>(m_X.size()); }
+
+    const float* X() const { return m_X.data(); }
+    const float* Y() const { return m_Y.data(); }
+    const float* Radius() const { return m_Radius.data(); }
+
+public:
+    // [first, last) 범위에서 query 와 충돌하는 인덱스를 오름차순으로 기록
+    // outIndices 는 최소 (last - first) 개를 담을 수 있어야 합니다.
+    uint32_t QueryOverlapIndices(const Circle& query, uint32_t first,
+                                 uint32_t last, uint32_t* outIndices,
+                                 SimdLevel level = MaxSimdLevel()) const;
+
+    uint32_t QueryOverlapIndices(const Circle& query, uint32_t* outIndices,
+                                 SimdLevel level = MaxSimdLevel()) const
+    {
+        return QueryOverlapIndices(query, 0, Size(), outIndices, level);
+    }
+
+    // 타일 [firstA, lastA) x [firstB, lastB) 의 충돌 쌍을 찾습니다.
+    // 두 범위가 같으면 a < b 인 쌍만 기록합니다.
+    // 최대 capacity 개까지 기록하고, 찾은 전체 쌍의 수를 반환합니다.
+    uint32_t QueryTileOverlapPairs(uint32_t firstA, uint32_t lastA,
+                                   uint32_t firstB, uint32_t lastB,
+                                   OverlapPair* outPairs, uint32_t capacity,
+                                   SimdLevel level = MaxSimdLevel()) const;
+
+private:
+    AlignedVector<float> m_X;
+    AlignedVector<float> m_Y;
+    AlignedVector<float> m_Radius;
+};
+
+} // namespace CitadelPhysicsEngine2D
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <CitadelPhysicsEngine2D/math/EngineMath.h>
+#include <CitadelPhysicsEngine2D/math/Transform2D.h>
+#include <CitadelPhysicsEngine2D/shapes/AABB.h>
+#include <CitadelPhysicsEngine2D/shapes/Polygon.h>
+
+namespace CitadelPhysicsEngine2D
+{
+
+// 회전된 사각형. 두 면 법선(axes)을 각도에서 미리 계산해 둡니다.
+struct OBB
+{
+    glm::vec2 center = {0.0f, 0.0f};
+    glm::vec2 halfExtents = {0.5f, 0.5f};
+    glm::vec2 axes[2] = {{1.0f, 0.0f}, {0.0f, 1.0f}};
+
+    OBB() = default;
+    // angle 은 라디안입니다.
+    OBB(const glm::vec2& center, const glm::vec2& halfExtents, float angle);
+
+    void SetAngle(float angle);
+
+    Transform2D GetTransform() const;
+    Polygon GetPolygon() const { return Polygon::MakeBox(halfExtents); }
+    AABB GetAABB() const;
+
+    // 4개 축에 대한 SAT 판정. AABBvsAABB 와 같이 true = 충돌하지 않음
+    static bool OBBvsOBB(const OBB& a, const OBB& b);
+};
+
+} // namespace CitadelPhysicsEngine2D
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstdint>
+
+namespace CitadelPhysicsEngine2D
+{
+
+struct OverlapPair
+{
+    uint32_t a;
+    uint32_t b;
+};
+
+} // namespace CitadelPhysicsEngine2D
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <CitadelPhysicsEngine2D/math/EngineMath.h>
+#include <CitadelPhysicsEngine2D/math/Transform2D.h>
+#include <CitadelPhysicsEngine2D/shapes/AABB.h>
+
+#include <cstdint>
+
+namespace CitadelPhysicsEngine2D
+{
+
+// 로컬 좌표계의 볼록 다각형 (반시계 방향 정점)
+// 변의 바깥쪽 법선을 생성 시 미리 계산해 둡니다.
+struct Polygon
+{
+    static constexpr uint32_t MaxVertices = 8;
+
+    glm::vec2 vertices[MaxVertices];
+    glm::vec2 normals[MaxVertices]; // normals[i] 는 vertices[i] → [i + 1] 변
+    glm::vec2 centroid = {0.0f, 0.0f};
+    uint32_t count = 0;
+
+    Polygon() = default;
+    Polygon(const glm::vec2* points, uint32_t pointCount);
+
+    static Polygon MakeBox(const glm::vec2& halfExtents);
+
+    AABB GetAABB(const Transform2D& xf) const;
+};
+
+} // namespace CitadelPhysicsEngine2D
@@ -1,4 +1,9 @@
 #pragma once
 
 #include "AABB.h"
+#include "AABBSoA.h"
 #include "Circle.h"
+#include "CircleSoA.h"
+#include "OBB.h"
+#include "OverlapPair.h"
+#include "Polygon.h"
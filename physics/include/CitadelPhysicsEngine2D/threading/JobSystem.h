@@ -0,0 +1,139 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace CitadelPhysicsEngine2D
+{
+
+// 예약한 작업을 가리키는 핸들
+// 작업이 끝나면 슬롯의 세대가 바뀌므로 오래된 핸들은 끝난 작업으로 봅니다.
+struct JobHandle
+{
+    static constexpr uint32_t InvalidIndex = 0xFFFFFFFFu;
+
+    uint32_t index = InvalidIndex;
+    uint32_t generation = 0;
+};
+
+// work stealing 작업 스케줄러 (물리 엔진과 앱이 함께 쓰는 스레드 풀)
+// 스레드마다 작업 큐를 두고, 자기 큐는 뒤에서 꺼내고(최근 작업 → 캐시
+// 친화적) 비면 다른 스레드 큐의 앞에서 훔쳐 옵니다. 병렬 for 는 범위를
+// 반으로 나눠 한쪽을 큐에 넣고 나머지를 계속 나누므로, 훔쳐 간 스레드가
+// 큰 덩어리를 가져가 부하가 저절로 맞춰집니다.
+//
+// Wait 를 부른 스레드(메인 스레드 포함)도 기다리는 동안 작업을 실행하므로
+// ThreadCount = 작업 스레드 + 1 입니다. 작업 스레드가 아닌 스레드는 모두
+// 0 번 큐를 같이 씁니다.
+class JobSystem
+{
+public:
+    using Function = std::function<void()>;
+    using RangeFunction = std::function<void(uint32_t begin, uint32_t end)>;
+
+    // 동시에 살아 있을 수 있는 작업 수 (넘치면 예약하는 스레드가 작업을
+    // 실행하며 빈 슬롯을 기다립니다.)
+    static constexpr uint32_t MaxJobs = 4096;
+
+    // threadCount 가 0 이면 하드웨어 스레드 수를 사용합니다.
+    explicit JobSystem(uint32_t threadCount = 0);
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    uint32_t GetThreadCount() const { return m_ThreadCount; }
+
+    // dependencies 가 모두 끝난 뒤 function 을 실행하도록 예약합니다.
+    JobHandle Schedule(Function function,
+                       const JobHandle* dependencies = nullptr,
+                       uint32_t dependencyCount = 0);
+    // function(begin, end) 를 [0, count) 의 grain 개 이하 구간마다 실행하도록
+    // 예약합니다. 모든 구간이 끝나야 핸들이 끝납니다.
+    JobHandle ScheduleParallelFor(uint32_t count, uint32_t grain,
+                                  RangeFunction function,
+                                  const JobHandle* dependencies = nullptr,
+                                  uint32_t dependencyCount = 0);
+
+    // body(begin, end) 로 ScheduleParallelFor 후 Wait 한 것과 같지만 body 를
+    // 복사하지 않으므로 std::function 을 만들지 않고 전역 할당자도 부르지
+    // 않습니다.
+    template <typename Body>
+    void ParallelFor(uint32_t count, uint32_t grain, const Body& body)
+    {
+        if (count == 0)
+            return;
+        if (m_ThreadCount == 1 || count <= grain)
+        {
+            body(0u, count);
+            return;
+        }
+        RunParallelFor(count, grain, &InvokeRange<Body>, &body);
+    }
+
+    // 호출 스레드의 번호 [0, ThreadCount). 작업 스레드가 아니면 0 입니다.
+    // 스레드별 버퍼(FrameArena 하위 arena 등)를 고르는 데 씁니다. 여러
+    // 스레드가 Wait 하면 0 번 버퍼를 함께 쓰게 되므로 호출하는 쪽에서
+    // 0 번의 주인을 정해야 합니다.
+    uint32_t GetCurrentThreadIndex() const;
+
+    bool IsDone(JobHandle handle) const;
+    // 끝날 때까지 호출 스레드도 큐의 작업을 실행합니다.
+    void Wait(JobHandle handle);
+
+private:
+    struct Job;
+    struct Queue;
+    using RangeInvoker = void (*)(const void* context, uint32_t begin,
+                                  uint32_t end);
+
+    template <typename Body>
+    static void InvokeRange(const void* context, uint32_t begin, uint32_t end)
+    {
+        (*static_cast<const Body*>(context))(begin, end);
+    }
+
+    void RunParallelFor(uint32_t count, uint32_t grain, RangeInvoker invoke,
+                        const void* context);
+
+    uint32_t AllocateJob();
+    void ReleaseJob(uint32_t index);
+    JobHandle Submit(uint32_t index, const JobHandle* dependencies,
+                     uint32_t dependencyCount);
+    JobHandle SubmitRange(uint32_t index, uint32_t count, uint32_t grain,
+                          const JobHandle* dependencies,
+                          uint32_t dependencyCount);
+
+    void Push(uint32_t index);
+    bool TryPop(uint32_t queueIndex, uint32_t& index);
+    bool TrySteal(uint32_t queueIndex, uint32_t& index);
+    bool TryRunOne(uint32_t queueIndex);
+    void Execute(uint32_t index);
+    void Finish(uint32_t index);
+
+    void WorkerLoop(uint32_t queueIndex);
+
+private:
+    uint32_t m_ThreadCount = 1; // 작업 스레드 시작 전에 정해짐
+    std::unique_ptr<Job[]> m_Jobs;
+    std::unique_ptr<Queue[]> m_Queues; // 0 번은 작업 스레드가 아닌 스레드용
+    std::vector<std::thread> m_Workers;
+
+    std::mutex m_FreeMutex;
+    std::vector<uint32_t> m_FreeJobs;
+
+    // 잠든 작업 스레드 깨우기
+    std::mutex m_WakeMutex;
+    std::condition_variable m_WakeCondition;
+    std::atomic<uint32_t> m_QueuedJobs{0};
+    std::atomic<uint32_t> m_SleepingWorkers{0};
+    bool m_Stopping = false;
+};
+
+} // namespace CitadelPhysicsEngine2D
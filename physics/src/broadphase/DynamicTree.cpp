@@ -0,0 +1,488 @@
+#include <CitadelPhysicsEngine2D/broadphase/DynamicTree.h>
+
+#include <CitadelPhysicsEngine2D/memory/SnapshotBuffer.h>
+
+#include <algorithm>
+
+namespace CitadelPhysicsEngine2D
+{
+
+DynamicTree::DynamicTree(float aabbMargin) : m_AABBMargin(aabbMargin) {}
+
+uint32_t DynamicTree::AllocateNode()
+{
+    uint32_t nodeId;
+    if (m_FreeList == NullNode)
+    {
+        nodeId = static_cast<uint32_t>(m_Nodes.size());
+        m_Nodes.emplace_back();
+    }
+    else
+    {
+        nodeId = m_FreeList;
+        m_FreeList = m_Nodes[nodeId].parent;
+    }
+
+    TreeNode& node = m_Nodes[nodeId];
+    node.parent = NullNode;
+    node.child1 = NullNode;
+    node.child2 = NullNode;
+    node.height = 0;
+    node.userData = 0;
+    node.moveSlot = NullNode;
+    return nodeId;
+}
+
+void DynamicTree::FreeNode(uint32_t nodeId)
+{
+    m_Nodes[nodeId].parent = m_FreeList;
+    m_Nodes[nodeId].height = -1;
+    m_FreeList = nodeId;
+}
+
+/**
+ * @brief 프록시를 이동 버퍼에 넣고 그 위치를 노드에 기록합니다.
+ *
+ * 이미 들어 있으면 아무것도 하지 않습니다.
+ */
+void DynamicTree::BufferMove(uint32_t proxyId)
+{
+    TreeNode& node = m_Nodes[proxyId];
+    if (node.moveSlot != NullNode)
+        return;
+    node.moveSlot = static_cast<uint32_t>(m_MoveBuffer.size());
+    m_MoveBuffer.push_back(proxyId);
+}
+
+/**
+ * @brief 새 프록시를 만들고 fat AABB 로 트리에 삽입합니다.
+ *
+ * @param aabb 물체의 실제 AABB
+ * @param userData 사용자 데이터 (보통 body 인덱스)
+ * @return uint32_t 프록시 id
+ */
+uint32_t DynamicTree::CreateProxy(const AABB& aabb, uint32_t userData)
+{
+    uint32_t proxyId = AllocateNode();
+
+    glm::vec2 margin(m_AABBMargin, m_AABBMargin);
+    TreeNode& node = m_Nodes[proxyId];
+    node.aabb = AABB(aabb.min - margin, aabb.max + margin);
+    node.userData = userData;
+
+    InsertLeaf(proxyId);
+    BufferMove(proxyId);
+    ++m_ProxyCount;
+    return proxyId;
+}
+
+/**
+ * @brief 프록시를 트리와 이동 버퍼에서 제거합니다.
+ *
+ * 이동 버퍼는 노드에 기록한 위치로 마지막 항목과 맞바꿔 지우므로 O(1) 입니다.
+ */
+void DynamicTree::DestroyProxy(uint32_t proxyId)
+{
+    const uint32_t slot = m_Nodes[proxyId].moveSlot;
+    if (slot != NullNode)
+    {
+        const uint32_t last = m_MoveBuffer.back();
+        m_MoveBuffer[slot] = last;
+        m_Nodes[last].moveSlot = slot;
+        m_MoveBuffer.pop_back();
+    }
+
+    RemoveLeaf(proxyId);
+    FreeNode(proxyId);
+    --m_ProxyCount;
+}
+
+/**
+ * @brief 프록시를 이동합니다.
+ *
+ * 새 AABB 가 기존 fat AABB 안에 있으면 트리를 건드리지 않습니다.
+ *
+ * @return true 재삽입된 경우
+ * @return false fat AABB 안에서 움직인 경우
+ */
+bool DynamicTree::MoveProxy(uint32_t proxyId, const AABB& aabb,
+                            const glm::vec2& displacement)
+{
+    if (m_Nodes[proxyId].aabb.Contains(aabb))
+        return false;
+
+    RemoveLeaf(proxyId);
+
+    glm::vec2 margin(m_AABBMargin, m_AABBMargin);
+    AABB fat(aabb.min - margin, aabb.max + margin);
+    // 이동 방향으로 늘려서 다음 프레임의 재삽입을 줄입니다.
+    fat.min += glm::min(displacement, glm::vec2(0.0f));
+    fat.max += glm::max(displacement, glm::vec2(0.0f));
+
+    m_Nodes[proxyId].aabb = fat;
+    InsertLeaf(proxyId); // 노드 할당으로 m_Nodes 가 재배치될 수 있음
+    BufferMove(proxyId);
+    return true;
+}
+
+/**
+ * @brief 둘레 기반 비용으로 형제 노드를 찾아 리프를 삽입합니다.
+ */
+void DynamicTree::InsertLeaf(uint32_t leaf)
+{
+    if (m_Root == NullNode)
+    {
+        m_Root = leaf;
+        m_Nodes[leaf].parent = NullNode;
+        return;
+    }
+
+    const AABB leafAABB = m_Nodes[leaf].aabb;
+    uint32_t index = m_Root;
+    while (m_Nodes[index].IsLeaf() == false)
+    {
+        const TreeNode& node = m_Nodes[index];
+        float area = node.aabb.GetPerimeter();
+        float combinedArea = AABB::Combine(node.aabb, leafAABB).GetPerimeter();
+
+        // 여기서 새 부모를 만드는 비용
+        float cost = 2.0f * combinedArea;
+        // 리프를 더 아래로 내려보낼 때 조상들이 커지는 비용
+        float inheritanceCost = 2.0f * (combinedArea - area);
+
+        auto descendCost = [&](uint32_t childId)
+        {
+            const TreeNode& child = m_Nodes[childId];
+            float combined = AABB::Combine(leafAABB, child.aabb).GetPerimeter();
+            if (child.IsLeaf())
+                return combined + inheritanceCost;
+            return (combined - child.aabb.GetPerimeter()) + inheritanceCost;
+        };
+
+        float cost1 = descendCost(node.child1);
+        float cost2 = descendCost(node.child2);
+        if (cost < cost1 && cost < cost2)
+            break;
+
+        index = cost1 < cost2 ? node.child1 : node.child2;
+    }
+
+    uint32_t sibling = index;
+    uint32_t oldParent = m_Nodes[sibling].parent;
+    uint32_t newParent = AllocateNode();
+
+    TreeNode& parentNode = m_Nodes[newParent];
+    parentNode.parent = oldParent;
+    parentNode.aabb = AABB::Combine(leafAABB, m_Nodes[sibling].aabb);
+    parentNode.height = m_Nodes[sibling].height + 1;
+    parentNode.child1 = sibling;
+    parentNode.child2 = leaf;
+
+    if (oldParent != NullNode)
+    {
+        if (m_Nodes[oldParent].child1 == sibling)
+            m_Nodes[oldParent].child1 = newParent;
+        else
+            m_Nodes[oldParent].child2 = newParent;
+    }
+    else
+    {
+        m_Root = newParent;
+    }
+    m_Nodes[sibling].parent = newParent;
+    m_Nodes[leaf].parent = newParent;
+
+    RefitAncestors(m_Nodes[leaf].parent);
+}
+
+void DynamicTree::RemoveLeaf(uint32_t leaf)
+{
+    if (leaf == m_Root)
+    {
+        m_Root = NullNode;
+        return;
+    }
+
+    uint32_t parent = m_Nodes[leaf].parent;
+    uint32_t grandParent = m_Nodes[parent].parent;
+    uint32_t sibling = m_Nodes[parent].child1 == leaf
+                           ? m_Nodes[parent].child2
+                           : m_Nodes[parent].child1;
+
+    if (grandParent != NullNode)
+    {
+        if (m_Nodes[grandParent].child1 == parent)
+            m_Nodes[grandParent].child1 = sibling;
+        else
+            m_Nodes[grandParent].child2 = sibling;
+        m_Nodes[sibling].parent = grandParent;
+        FreeNode(parent);
+
+        RefitAncestors(grandParent);
+    }
+    else
+    {
+        m_Root = sibling;
+        m_Nodes[sibling].parent = NullNode;
+        FreeNode(parent);
+    }
+}
+
+/**
+ * @brief nodeId 부터 루트까지 균형을 맞추고 AABB/높이를 다시 계산합니다.
+ */
+void DynamicTree::RefitAncestors(uint32_t nodeId)
+{
+    while (nodeId != NullNode)
+    {
+        nodeId = Balance(nodeId);
+
+        TreeNode& node = m_Nodes[nodeId];
+        const TreeNode& child1 = m_Nodes[node.child1];
+        const TreeNode& child2 = m_Nodes[node.child2];
+        node.height = 1 + std::max(child1.height, child2.height);
+        node.aabb = AABB::Combine(child1.aabb, child2.aabb);
+
+        nodeId = node.parent;
+    }
+}
+
+/**
+ * @brief 높이 차이가 1 보다 크면 한 번 회전하여 균형을 맞춥니다.
+ *
+ *        A
+ *      /   \
+ *     B     C
+ *          / \
+ *         F   G
+ *
+ * @return uint32_t 회전 후 이 서브트리의 루트
+ */
+uint32_t DynamicTree::Balance(uint32_t iA)
+{
+    TreeNode* A = &m_Nodes[iA];
+    if (A->IsLeaf() || A->height < 2)
+        return iA;
+
+    uint32_t iB = A->child1;
+    uint32_t iC = A->child2;
+    TreeNode* B = &m_Nodes[iB];
+    TreeNode* C = &m_Nodes[iC];
+
+    int32_t balance = C->height - B->height;
+
+    auto replaceChild = [&](uint32_t parent, uint32_t oldChild,
+                            uint32_t newChild)
+    {
+        if (parent == NullNode)
+        {
+            m_Root = newChild;
+            return;
+        }
+        if (m_Nodes[parent].child1 == oldChild)
+            m_Nodes[parent].child1 = newChild;
+        else
+            m_Nodes[parent].child2 = newChild;
+    };
+
+    // C 를 위로 올림
+    if (balance > 1)
+    {
+        uint32_t iF = C->child1;
+        uint32_t iG = C->child2;
+        TreeNode* F = &m_Nodes[iF];
+        TreeNode* G = &m_Nodes[iG];
+
+        C->child1 = iA;
+        C->parent = A->parent;
+        A->parent = iC;
+        replaceChild(C->parent, iA, iC);
+
+        if (F->height > G->height)
+        {
+            C->child2 = iF;
+            A->child2 = iG;
+            G->parent = iA;
+            A->aabb = AABB::Combine(B->aabb, G->aabb);
+            C->aabb = AABB::Combine(A->aabb, F->aabb);
+            A->height = 1 + std::max(B->height, G->height);
+            C->height = 1 + std::max(A->height, F->height);
+        }
+        else
+        {
+            C->child2 = iG;
+            A->child2 = iF;
+            F->parent = iA;
+            A->aabb = AABB::Combine(B->aabb, F->aabb);
+            C->aabb = AABB::Combine(A->aabb, G->aabb);
+            A->height = 1 + std::max(B->height, F->height);
+            C->height = 1 + std::max(A->height, G->height);
+        }
+        return iC;
+    }
+
+    // B 를 위로 올림
+    if (balance < -1)
+    {
+        uint32_t iD = B->child1;
+        uint32_t iE = B->child2;
+        TreeNode* D = &m_Nodes[iD];
+        TreeNode* E = &m_Nodes[iE];
+
+        B->child1 = iA;
+        B->parent = A->parent;
+        A->parent = iB;
+        replaceChild(B->parent, iA, iB);
+
+        if (D->height > E->height)
+        {
+            B->child2 = iD;
+            A->child1 = iE;
+            E->parent = iA;
+            A->aabb = AABB::Combine(C->aabb, E->aabb);
+            B->aabb = AABB::Combine(A->aabb, D->aabb);
+            A->height = 1 + std::max(C->height, E->height);
+            B->height = 1 + std::max(A->height, D->height);
+        }
+        else
+        {
+            B->child2 = iE;
+            A->child1 = iD;
+            D->parent = iA;
+            A->aabb = AABB::Combine(C->aabb, D->aabb);
+            B->aabb = AABB::Combine(A->aabb, E->aabb);
+            A->height = 1 + std::max(C->height, D->height);
+            B->height = 1 + std::max(A->height, E->height);
+        }
+        return iB;
+    }
+
+    return iA;
+}
+
+void DynamicTree::SortPairs(std::vector<OverlapPair>& pairs) const
+{
+    std::sort(pairs.begin(), pairs.end(),
+              [](const OverlapPair& l, const OverlapPair& r)
+              { return l.a != r.a ? l.a < r.a : l.b < r.b; });
+}
+
+/**
+ * @brief fat AABB 가 겹치는 모든 프록시 쌍을 찾습니다.
+ *
+ * @param outPairs 결과 쌍 (기존 내용은 지워짐, a < b, 사전순)
+ */
+void DynamicTree::QueryAllPairs(std::vector<OverlapPair>& outPairs) const
+{
+    outPairs.clear();
+    for (uint32_t i = 0; i < m_Nodes.size(); ++i)
+    {
+        if (m_Nodes[i].height != 0)
+            continue;
+
+        Query(m_Nodes[i].aabb,
+              [&](uint32_t proxyId)
+              {
+                  if (proxyId > i)
+                      outPairs.push_back({i, proxyId});
+                  return true;
+              });
+    }
+    SortPairs(outPairs);
+}
+
+/**
+ * @brief 이동 버퍼의 프록시가 포함된 fat AABB 충돌 쌍을 찾습니다.
+ *
+ * 두 프록시가 모두 이동한 경우에도 쌍은 한 번만 기록됩니다.
+ *
+ * @param outPairs 결과 쌍 (기존 내용은 지워짐, a < b, 사전순)
+ */
+void DynamicTree::QueryMovedPairs(std::vector<OverlapPair>& outPairs)
+{
+    outPairs.clear();
+    for (uint32_t movedId : m_MoveBuffer)
+    {
+        Query(m_Nodes[movedId].aabb,
+              [&](uint32_t proxyId)
+              {
+                  if (proxyId == movedId)
+                      return true;
+                  // 둘 다 이동했다면 id 가 작은 쪽에서만 기록
+                  if (m_Nodes[proxyId].moveSlot != NullNode &&
+                      proxyId < movedId)
+                      return true;
+                  outPairs.push_back({std::min(movedId, proxyId),
+                                      std::max(movedId, proxyId)});
+                  return true;
+              });
+    }
+
+    for (uint32_t movedId : m_MoveBuffer)
+        m_Nodes[movedId].moveSlot = NullNode;
+    m_MoveBuffer.clear();
+
+    SortPairs(outPairs);
+}
+
+/**
+ * @brief 트리 구조를 스냅샷에 기록합니다.
+ *
+ * 노드는 인덱스로 연결되어 있으므로 배열을 그대로 복사하면 프록시 id 와
+ * 트리 모양이 그대로 보존됩니다. margin 은 설정이므로 넣지 않습니다.
+ */
+void DynamicTree::SaveState(SnapshotWriter& writer) const
+{
+    writer.Write(m_Root);
+    writer.Write(m_FreeList);
+    writer.Write(m_ProxyCount);
+    writer.WriteArray(m_Nodes);
+    writer.WriteArray(m_MoveBuffer);
+}
+
+void DynamicTree::RestoreState(SnapshotReader& reader)
+{
+    reader.Read(m_Root);
+    reader.Read(m_FreeList);
+    reader.Read(m_ProxyCount);
+    reader.ReadArray(m_Nodes);
+    reader.ReadArray(m_MoveBuffer);
+}
+
+int32_t DynamicTree::GetHeight() const
+{
+    return m_Root == NullNode ? 0 : m_Nodes[m_Root].height;
+}
+
+bool DynamicTree::ValidateNode(uint32_t nodeId) const
+{
+    const TreeNode& node = m_Nodes[nodeId];
+    if (node.IsLeaf())
+        return node.height == 0;
+
+    const TreeNode& child1 = m_Nodes[node.child1];
+    const TreeNode& child2 = m_Nodes[node.child2];
+    if (child1.parent != nodeId || child2.parent != nodeId)
+        return false;
+    if (node.height != 1 + std::max(child1.height, child2.height))
+        return false;
+    if (node.aabb.Contains(child1.aabb) == false ||
+        node.aabb.Contains(child2.aabb) == false)
+        return false;
+
+    return ValidateNode(node.child1) && ValidateNode(node.child2);
+}
+
+/**
+ * @brief 부모 링크, 높이, AABB 포함 관계를 검사합니다. (테스트용)
+ */
+bool DynamicTree::Validate() const
+{
+    if (m_Root == NullNode)
+        return m_ProxyCount == 0;
+    if (m_Nodes[m_Root].parent != NullNode)
+        return false;
+    return ValidateNode(m_Root);
+}
+
+} // namespace CitadelPhysicsEngine2D
@@ -0,0 +1,109 @@
+#include <CitadelPhysicsEngine2D/broadphase/ParallelPairFinder.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace CitadelPhysicsEngine2D
+{
+
+ParallelPairFinder::ParallelPairFinder(JobSystem& jobs) : m_Jobs(jobs) {}
+
+/**
+ * @brief 컨테이너 내부의 모든 충돌 쌍을 병렬로 찾습니다.
+ *
+ * 질의 i 의 작업량은 (n - i) 에 비례하므로, 구간 경계를
+ * n * (1 - sqrt(1 - k / K)) 로 잡아 구간별 작업량을 맞춥니다.
+ */
+void ParallelPairFinder::FindSelfPairs(const AABBSoA& boxes,
+                                       std::vector<OverlapPair>& outPairs,
+                                       SimdLevel level)
+{
+    const uint32_t n = boxes.Size();
+    const uint32_t rangeCount =
+        std::max(1u, std::min(m_Jobs.GetThreadCount(), n));
+
+    m_RangeStart.resize(rangeCount + 1);
+    for (uint32_t k = 0; k <= rangeCount; ++k)
+    {
+        double t = 1.0 - std::sqrt(1.0 - double(k) / double(rangeCount));
+        m_RangeStart[k] = static_cast<uint32_t>(double(n) * t);
+    }
+    m_RangeStart[rangeCount] = n;
+
+    m_RangePairs.resize(rangeCount);
+    m_Jobs.ParallelFor(
+        rangeCount, 1,
+        [&](uint32_t begin, uint32_t end)
+        {
+            for (uint32_t range = begin; range < end; ++range)
+            {
+                std::vector<OverlapPair>& pairs = m_RangePairs[range];
+                pairs.clear();
+                for (uint32_t a = m_RangeStart[range];
+                     a < m_RangeStart[range + 1]; ++a)
+                {
+                    boxes.QueryOverlapRange(boxes.Get(a), a + 1, n, a, pairs,
+                                            level);
+                }
+            }
+        });
+
+    Merge(outPairs);
+}
+
+/**
+ * @brief queries 의 각 원소를 targets 전체와 병렬로 비교합니다.
+ */
+void ParallelPairFinder::FindPairs(const AABBSoA& queries,
+                                   const AABBSoA& targets,
+                                   std::vector<OverlapPair>& outPairs,
+                                   SimdLevel level)
+{
+    const uint32_t n = queries.Size();
+    const uint32_t rangeCount =
+        std::max(1u, std::min(m_Jobs.GetThreadCount(), n));
+
+    m_RangeStart.resize(rangeCount + 1);
+    for (uint32_t k = 0; k <= rangeCount; ++k)
+        m_RangeStart[k] = static_cast<uint32_t>(uint64_t(n) * k / rangeCount);
+
+    m_RangePairs.resize(rangeCount);
+    m_Jobs.ParallelFor(
+        rangeCount, 1,
+        [&](uint32_t begin, uint32_t end)
+        {
+            for (uint32_t range = begin; range < end; ++range)
+            {
+                std::vector<OverlapPair>& pairs = m_RangePairs[range];
+                pairs.clear();
+                for (uint32_t a = m_RangeStart[range];
+                     a < m_RangeStart[range + 1]; ++a)
+                {
+                    targets.QueryOverlapRange(queries.Get(a), 0,
+                                              targets.Size(), a, pairs, level);
+                }
+            }
+        });
+
+    Merge(outPairs);
+}
+
+/**
+ * @brief 구간 버퍼를 구간 순서대로 이어 붙입니다. (결정적 병합)
+ */
+void ParallelPairFinder::Merge(std::vector<OverlapPair>& outPairs) const
+{
+    size_t total = 0;
+    for (uint32_t range = 0; range + 1 < m_RangeStart.size(); ++range)
+        total += m_RangePairs[range].size();
+
+    outPairs.clear();
+    outPairs.reserve(total);
+    for (uint32_t range = 0; range + 1 < m_RangeStart.size(); ++range)
+    {
+        outPairs.insert(outPairs.end(), m_RangePairs[range].begin(),
+                        m_RangePairs[range].end());
+    }
+}
+
+} // namespace CitadelPhysicsEngine2D
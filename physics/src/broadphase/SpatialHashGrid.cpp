@@ -0,0 +1,158 @@
+#include <CitadelPhysicsEngine2D/broadphase/SpatialHashGrid.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace CitadelPhysicsEngine2D
+{
+
+SpatialHashGrid::SpatialHashGrid(float cellSize) : m_CellSize(cellSize) {}
+
+uint32_t SpatialHashGrid::HashCell(int32_t cx, int32_t cy) const
+{
+    uint32_t h = static_cast<uint32_t>(cx) * 73856093u ^
+                 static_cast<uint32_t>(cy) * 19349663u;
+    return h & m_TableMask;
+}
+
+int32_t SpatialHashGrid::CellCoord(float v) const
+{
+    return static_cast<int32_t>(std::floor(v * m_InvCellSize));
+}
+
+void SpatialHashGrid::FindPairs(const CircleSoA& circles,
+                                std::vector<OverlapPair>& outPairs)
+{
+    Build(circles.X(), circles.Y(), circles.Radius(), circles.Size());
+    Sweep(circles.X(), circles.Y(), circles.Radius(), outPairs);
+}
+
+void SpatialHashGrid::FindPairs(const Circle* circles, uint32_t count,
+                                std::vector<OverlapPair>& outPairs)
+{
+    // AoS 입력은 먼저 SoA 로 모은 뒤 같은 경로로 처리합니다.
+    m_InputX.resize(count);
+    m_InputY.resize(count);
+    m_InputRadius.resize(count);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        m_InputX[i] = circles[i].position.x;
+        m_InputY[i] = circles[i].position.y;
+        m_InputRadius[i] = circles[i].radius;
+    }
+    Build(m_InputX.data(), m_InputY.data(), m_InputRadius.data(), count);
+    Sweep(m_InputX.data(), m_InputY.data(), m_InputRadius.data(), outPairs);
+}
+
+/**
+ * @brief 원을 셀 해시로 counting sort 하여 셀별 연속 구간을 만듭니다.
+ *
+ * 셀 크기가 가장 큰 지름 이상이면 충돌하는 두 원의 중심은 항상
+ * 서로 이웃한 셀(3x3)에 있습니다.
+ */
+void SpatialHashGrid::Build(const float* x, const float* y,
+                            const float* radius, uint32_t count)
+{
+    float maxRadius = 0.0f;
+    for (uint32_t i = 0; i < count; ++i)
+        maxRadius = std::max(maxRadius, radius[i]);
+    m_EffectiveCellSize = std::max(m_CellSize, 2.0f * maxRadius);
+    m_InvCellSize = 1.0f / m_EffectiveCellSize;
+
+    uint32_t tableSize = 64;
+    while (tableSize < count * 2)
+        tableSize <<= 1;
+    m_TableMask = tableSize - 1;
+
+    m_BodyCell.resize(count);
+    m_CellStart.assign(tableSize + 1, 0);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        uint32_t h = HashCell(CellCoord(x[i]), CellCoord(y[i]));
+        m_BodyCell[i] = h;
+        ++m_CellStart[h + 1];
+    }
+    for (uint32_t h = 0; h < tableSize; ++h)
+        m_CellStart[h + 1] += m_CellStart[h];
+
+    m_SortedIndex.resize(count);
+    m_SortedX.resize(count);
+    m_SortedY.resize(count);
+    m_SortedRadius.resize(count);
+
+    // m_CellStart[h] 를 쓰기 커서로 쓰고 나면 한 칸씩 밀리므로 되돌립니다.
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        uint32_t slot = m_CellStart[m_BodyCell[i]]++;
+        m_SortedIndex[slot] = i;
+        m_SortedX[slot] = x[i];
+        m_SortedY[slot] = y[i];
+        m_SortedRadius[slot] = radius[i];
+    }
+    for (uint32_t h = tableSize; h > 0; --h)
+        m_CellStart[h] = m_CellStart[h - 1];
+    m_CellStart[0] = 0;
+}
+
+/**
+ * @brief 원을 원래 순서로 순회하며 3x3 이웃 셀의 원과 비교합니다.
+ *
+ * 원 i 의 쌍은 한꺼번에 기록되므로 i 의 쌍만 b 순으로 정렬하면 전체가
+ * 사전순이 됩니다. (전체 쌍 정렬 불필요)
+ *
+ * @param outPairs 결과 쌍 (기존 내용은 지워짐, a < b, 사전순)
+ */
+void SpatialHashGrid::Sweep(const float* x, const float* y,
+                            const float* radius,
+                            std::vector<OverlapPair>& outPairs) const
+{
+    outPairs.clear();
+
+    const uint32_t count = static_cast<uint32_t>(m_SortedIndex.size());
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        const float xi = x[i];
+        const float yi = y[i];
+        const float ri = radius[i];
+        const int32_t cx = CellCoord(xi);
+        const int32_t cy = CellCoord(yi);
+        const size_t first = outPairs.size();
+
+        // 해시 충돌로 같은 버킷을 두 번 보지 않도록 방문한 해시를 기록
+        uint32_t visited[9];
+        uint32_t visitedCount = 0;
+        for (int32_t dy = -1; dy <= 1; ++dy)
+        {
+            for (int32_t dx = -1; dx <= 1; ++dx)
+            {
+                uint32_t h = HashCell(cx + dx, cy + dy);
+                if (std::find(visited, visited + visitedCount, h) !=
+                    visited + visitedCount)
+                    continue;
+                visited[visitedCount++] = h;
+
+                for (uint32_t t = m_CellStart[h]; t < m_CellStart[h + 1]; ++t)
+                {
+                    const uint32_t j = m_SortedIndex[t];
+                    if (j <= i)
+                        continue;
+
+                    // Circle::CirclevsCircle(circles[i], circles[j]) 와 동일
+                    float r = ri + m_SortedRadius[t];
+                    float px = xi - m_SortedX[t];
+                    float py = yi - m_SortedY[t];
+                    if ((r * r) < ((px * px) + (py * py)))
+                        continue;
+
+                    outPairs.push_back({i, j});
+                }
+            }
+        }
+
+        std::sort(outPairs.begin() + first, outPairs.end(),
+                  [](const OverlapPair& l, const OverlapPair& r)
+                  { return l.b < r.b; });
+    }
+}
+
+} // namespace CitadelPhysicsEngine2D
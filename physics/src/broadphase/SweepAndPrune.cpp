@@ -0,0 +1,157 @@
+#include <CitadelPhysicsEngine2D/broadphase/SweepAndPrune.h>
+
+#include <algorithm>
+
+namespace CitadelPhysicsEngine2D
+{
+
+uint32_t SweepAndPrune::CreateProxy(const AABB& box)
+{
+    uint32_t proxyId;
+    if (m_FreeList.empty() == false)
+    {
+        proxyId = m_FreeList.back();
+        m_FreeList.pop_back();
+        m_Proxies[proxyId] = box;
+        m_Alive[proxyId] = 1;
+    }
+    else
+    {
+        proxyId = static_cast<uint32_t>(m_Proxies.size());
+        m_Proxies.push_back(box);
+        m_Alive.push_back(1);
+    }
+    ++m_ProxyCount;
+
+    // 새 끝점은 뒤에 붙이고 다음 UpdatePairs 의 삽입 정렬이 제자리로 옮깁니다.
+    for (int axis = 0; axis < 2; ++axis)
+    {
+        m_Endpoints[axis].push_back({box.min[axis], proxyId << 1});
+        m_Endpoints[axis].push_back({box.max[axis], (proxyId << 1) | 1u});
+    }
+    return proxyId;
+}
+
+void SweepAndPrune::DestroyProxy(uint32_t proxyId)
+{
+    if (proxyId >= m_Alive.size() || m_Alive[proxyId] == 0)
+        return;
+
+    for (auto& endpoints : m_Endpoints)
+    {
+        endpoints.erase(std::remove_if(endpoints.begin(), endpoints.end(),
+                                       [proxyId](const Endpoint& e)
+                                       { return (e.data >> 1) == proxyId; }),
+                        endpoints.end());
+    }
+
+    m_Alive[proxyId] = 0;
+    m_FreeList.push_back(proxyId);
+    --m_ProxyCount;
+}
+
+void SweepAndPrune::MoveProxy(uint32_t proxyId, const AABB& box)
+{
+    m_Proxies[proxyId] = box;
+}
+
+void SweepAndPrune::RefreshEndpoints(std::vector<Endpoint>& endpoints,
+                                     int axis) const
+{
+    for (Endpoint& e : endpoints)
+    {
+        const AABB& box = m_Proxies[e.data >> 1];
+        e.value = (e.data & 1u) ? box.max[axis] : box.min[axis];
+    }
+}
+
+/**
+ * @brief 거의 정렬된 끝점 리스트를 삽입 정렬합니다.
+ *
+ * 같은 값에서는 min 끝점이 max 끝점보다 앞에 오도록 하여
+ * 경계가 맞닿은 AABB 도 겹친 것으로 처리합니다. (AABBvsAABB 와 동일)
+ */
+void SweepAndPrune::InsertionSort(std::vector<Endpoint>& endpoints)
+{
+    auto less = [](const Endpoint& a, const Endpoint& b)
+    {
+        if (a.value != b.value)
+            return a.value < b.value;
+        return (a.data & 1u) < (b.data & 1u);
+    };
+
+    for (size_t i = 1; i < endpoints.size(); ++i)
+    {
+        Endpoint key = endpoints[i];
+        size_t j = i;
+        while (j > 0 && less(key, endpoints[j - 1]))
+        {
+            endpoints[j] = endpoints[j - 1];
+            --j;
+        }
+        endpoints[j] = key;
+    }
+}
+
+/**
+ * @brief 끝점 리스트를 정렬하고 분산이 큰 축을 따라 sweep 하여
+ * 잠재 충돌 쌍을 찾습니다.
+ *
+ * @param outPairs 결과 쌍 (기존 내용은 지워짐)
+ */
+void SweepAndPrune::UpdatePairs(std::vector<OverlapPair>& outPairs)
+{
+    outPairs.clear();
+
+    for (int axis = 0; axis < 2; ++axis)
+    {
+        RefreshEndpoints(m_Endpoints[axis], axis);
+        InsertionSort(m_Endpoints[axis]);
+    }
+
+    // 중심 분포가 넓은 축으로 sweep 해야 활성 리스트가 짧아집니다.
+    glm::vec2 sum(0.0f), sumSq(0.0f);
+    for (uint32_t i = 0; i < m_Proxies.size(); ++i)
+    {
+        if (m_Alive[i] == 0)
+            continue;
+        glm::vec2 c = (m_Proxies[i].min + m_Proxies[i].max) * 0.5f;
+        sum += c;
+        sumSq += c * c;
+    }
+    glm::vec2 variance = sumSq - sum * sum / float(std::max(m_ProxyCount, 1u));
+    const int axis = variance.x >= variance.y ? 0 : 1;
+    const int other = 1 - axis;
+
+    m_Active.clear();
+    for (const Endpoint& e : m_Endpoints[axis])
+    {
+        uint32_t id = e.data >> 1;
+        if (e.data & 1u)
+        {
+            auto it = std::find(m_Active.begin(), m_Active.end(), id);
+            *it = m_Active.back();
+            m_Active.pop_back();
+            continue;
+        }
+
+        const AABB& box = m_Proxies[id];
+        for (uint32_t activeId : m_Active)
+        {
+            const AABB& activeBox = m_Proxies[activeId];
+            if (activeBox.max[other] < box.min[other] ||
+                activeBox.min[other] > box.max[other])
+                continue;
+
+            outPairs.push_back(
+                {std::min(id, activeId), std::max(id, activeId)});
+        }
+        m_Active.push_back(id);
+    }
+
+    std::sort(outPairs.begin(), outPairs.end(),
+              [](const OverlapPair& l, const OverlapPair& r)
+              { return l.a != r.a ? l.a < r.a : l.b < r.b; });
+}
+
+} // namespace CitadelPhysicsEngine2D
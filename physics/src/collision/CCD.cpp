@@ -0,0 +1,257 @@
+#include <CitadelPhysicsEngine2D/collision/CCD.h>
+
+#include <CitadelPhysicsEngine2D/collision/Narrowphase.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace CitadelPhysicsEngine2D
+{
+
+namespace
+{
+
+// 점 p 가 d 만큼 이동할 때 (center, radius) 원에 처음 닿는 시점
+// 시작부터 원 안이면 t = 0 입니다.
+bool SweepPointCircle(const glm::vec2& p, const glm::vec2& d,
+                      const glm::vec2& center, float radius, float& t)
+{
+    glm::vec2 s = p - center;
+    float c = glm::dot(s, s) - radius * radius;
+    if (c <= 0.0f)
+    {
+        t = 0.0f;
+        return true;
+    }
+
+    float b = glm::dot(s, d);
+    if (b >= 0.0f)
+        return false; // 멀어지거나 정지
+
+    float a = glm::dot(d, d);
+    float disc = b * b - a * c;
+    if (disc < 0.0f)
+        return false;
+
+    t = (-b - std::sqrt(disc)) / a;
+    return t <= 1.0f;
+}
+
+glm::vec2 SafeNormalize(const glm::vec2& v)
+{
+    float lenSq = glm::dot(v, v);
+    if (lenSq <= 0.0f)
+        return {1.0f, 0.0f};
+    return v / std::sqrt(lenSq);
+}
+
+AABB GetSweptAABB(const Circle& circle, const glm::vec2& d)
+{
+    Circle end(circle.radius, circle.position + d);
+    return AABB::Combine(circle.GetAABB(), end.GetAABB());
+}
+
+} // namespace
+
+/**
+ * @brief 움직이는 두 원의 최초 충돌 시점을 계산합니다.
+ *
+ * B 에 대한 A 의 상대 변위로 점을 (rA + rB) 원에 스윕하는 문제로 바꿉니다.
+ *
+ * @param a 원 A (스텝 시작 위치)
+ * @param dA 이번 스텝의 A 변위
+ * @param b 원 B (스텝 시작 위치)
+ * @param dB 이번 스텝의 B 변위
+ * @param result 충돌 시 t 와 그 시점의 법선 (A → B)
+ * @return true [0, 1] 구간에서 닿는 경우
+ */
+bool TimeOfImpactCircles(const Circle& a, const glm::vec2& dA,
+                         const Circle& b, const glm::vec2& dB,
+                         TOIResult& result)
+{
+    float t;
+    if (SweepPointCircle(a.position, dA - dB, b.position,
+                         a.radius + b.radius, t) == false)
+        return false;
+
+    result.t = t;
+    result.normal = SafeNormalize((b.position + t * dB) -
+                                  (a.position + t * dA));
+    return true;
+}
+
+/**
+ * @brief 움직이는 원과 정지한 AABB 의 최초 충돌 시점을 계산합니다.
+ *
+ * 원의 중심을 반지름만큼 부푼 상자(둥근 모서리)에 대해 선분으로
+ * 스윕합니다. 슬랩 검사로 부푼 사각형과의 진입점을 구하고, 진입점이
+ * 모서리 영역이면 해당 꼭짓점의 원과 다시 검사합니다.
+ */
+bool TimeOfImpactCircleAABB(const Circle& a, const glm::vec2& d,
+                            const AABB& b, TOIResult& result)
+{
+    ContactManifold manifold;
+    if (CollideCircleAABB(a, b, manifold))
+    {
+        result.t = 0.0f;
+        result.normal = manifold.normal;
+        return true;
+    }
+
+    const glm::vec2 p = a.position;
+    const glm::vec2 expandedMin = b.min - a.radius;
+    const glm::vec2 expandedMax = b.max + a.radius;
+
+    float tMin = 0.0f;
+    float tMax = 1.0f;
+    glm::vec2 normal(0.0f, 0.0f);
+    for (int axis = 0; axis < 2; ++axis)
+    {
+        if (d[axis] == 0.0f)
+        {
+            if (p[axis] < expandedMin[axis] || p[axis] > expandedMax[axis])
+                return false;
+            continue;
+        }
+
+        float inv = 1.0f / d[axis];
+        float t1 = (expandedMin[axis] - p[axis]) * inv;
+        float t2 = (expandedMax[axis] - p[axis]) * inv;
+        // 최소 면으로 들어오면 상자는 +axis 방향에 있음
+        float sign = 1.0f;
+        if (t1 > t2)
+        {
+            std::swap(t1, t2);
+            sign = -1.0f;
+        }
+        if (t1 > tMin)
+        {
+            tMin = t1;
+            normal = {0.0f, 0.0f};
+            normal[axis] = sign;
+        }
+        tMax = std::min(tMax, t2);
+        if (tMin > tMax)
+            return false;
+    }
+
+    // 진입점이 원래 상자의 두 축 모두 바깥이면 모서리 영역
+    glm::vec2 hit = p + tMin * d;
+    glm::vec2 corner;
+    bool outsideX = hit.x < b.min.x || hit.x > b.max.x;
+    bool outsideY = hit.y < b.min.y || hit.y > b.max.y;
+    if (outsideX && outsideY)
+    {
+        corner.x = hit.x < b.min.x ? b.min.x : b.max.x;
+        corner.y = hit.y < b.min.y ? b.min.y : b.max.y;
+
+        float t;
+        if (SweepPointCircle(p, d, corner, a.radius, t) == false)
+            return false;
+        result.t = t;
+        result.normal = SafeNormalize(corner - (p + t * d));
+        return true;
+    }
+
+    result.t = tMin;
+    result.normal = normal;
+    return true;
+}
+
+/**
+ * @brief bullet 이거나 변위가 motionThreshold * radius 를 넘는지 봅니다.
+ */
+bool NeedsTimeOfImpact(const glm::vec2& d, float radius, bool bullet,
+                       const CCDSettings& settings)
+{
+    const float limit = settings.motionThreshold * radius;
+    return bullet || glm::dot(d, d) > limit * limit;
+}
+
+/**
+ * @brief CCD 단계: 빠른 원들의 이번 스텝 최초 충돌을 찾습니다.
+ *
+ * 후보 원의 스윕 AABB 로 상자와 다른 원들의 스윕 AABB 를 SoA 질의로
+ * 추린 뒤에만 TOI 를 계산합니다. 같은 t 면 상자, 작은 인덱스 순으로
+ * 선택하므로 결과는 결정적입니다.
+ *
+ * @return uint32_t outEvents 에 추가된 이벤트 수
+ */
+uint32_t FindTimeOfImpacts(const CircleSoA& circles,
+                           const glm::vec2* displacements,
+                           const uint8_t* bullets, const AABBSoA& boxes,
+                           const CCDSettings& settings,
+                           std::vector<TOIEvent>& outEvents,
+                           StackArena* scratch)
+{
+    const uint32_t n = circles.Size();
+    const size_t first = outEvents.size();
+
+    AlignedVector<uint32_t> candidates{AlignedAllocator<uint32_t>(scratch)};
+    candidates.reserve(n);
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        bool bullet = bullets != nullptr && bullets[i] != 0;
+        if (NeedsTimeOfImpact(displacements[i], circles.Radius()[i], bullet,
+                              settings))
+            candidates.push_back(i);
+    }
+    if (candidates.empty())
+        return 0;
+
+    AABBSoA swept(scratch);
+    swept.Reserve(n);
+    for (uint32_t i = 0; i < n; ++i)
+        swept.Add(GetSweptAABB(circles.Get(i), displacements[i]));
+
+    AlignedVector<uint32_t> indices(std::max(n, boxes.Size()), 0u,
+                                    AlignedAllocator<uint32_t>(scratch));
+    for (uint32_t i : candidates)
+    {
+        const Circle circle = circles.Get(i);
+        const glm::vec2& d = displacements[i];
+        const AABB bounds = swept.Get(i);
+
+        TOIEvent best;
+        best.circle = i;
+        bool found = false;
+        TOIResult toi;
+
+        uint32_t count = boxes.QueryOverlapIndices(bounds, indices.data());
+        for (uint32_t k = 0; k < count; ++k)
+        {
+            if (TimeOfImpactCircleAABB(circle, d, boxes.Get(indices[k]),
+                                       toi) &&
+                (found == false || toi.t < best.toi.t))
+            {
+                best.other = indices[k];
+                best.otherIsBox = true;
+                best.toi = toi;
+                found = true;
+            }
+        }
+
+        count = swept.QueryOverlapIndices(bounds, indices.data());
+        for (uint32_t k = 0; k < count; ++k)
+        {
+            uint32_t j = indices[k];
+            if (j == i)
+                continue;
+            if (TimeOfImpactCircles(circle, d, circles.Get(j),
+                                    displacements[j], toi) &&
+                (found == false || toi.t < best.toi.t))
+            {
+                best.other = j;
+                best.otherIsBox = false;
+                best.toi = toi;
+                found = true;
+            }
+        }
+
+        if (found)
+            outEvents.push_back(best);
+    }
+    return static_cast<uint32_t>(outEvents.size() - first);
+}
+
+} // namespace CitadelPhysicsEngine2D
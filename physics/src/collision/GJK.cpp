@@ -0,0 +1,539 @@
+#include <CitadelPhysicsEngine2D/collision/GJK.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace CitadelPhysicsEngine2D
+{
+
+namespace
+{
+
+constexpr uint32_t MaxGJKIterations = 20;
+constexpr uint32_t MaxEPAVertices = 32;
+constexpr float EPATolerance = 1.0e-4f;
+
+float Cross(const glm::vec2& a, const glm::vec2& b)
+{
+    return a.x * b.y - a.y * b.x;
+}
+
+struct SimplexVertex
+{
+    glm::vec2 wA;    // A 의 지지점
+    glm::vec2 wB;    // B 의 지지점
+    glm::vec2 w;     // wB - wA (민코프스키 차)
+    float a;         // 최근접점의 무게중심 좌표
+    uint32_t indexA;
+    uint32_t indexB;
+};
+
+struct Simplex
+{
+    SimplexVertex v[3];
+    uint32_t count = 0;
+
+    void SetVertex(SimplexVertex& vertex, const ConvexProxy& proxyA,
+                   uint32_t indexA, const ConvexProxy& proxyB,
+                   uint32_t indexB)
+    {
+        vertex.indexA = indexA;
+        vertex.indexB = indexB;
+        vertex.wA = proxyA.vertices[indexA];
+        vertex.wB = proxyB.vertices[indexB];
+        vertex.w = vertex.wB - vertex.wA;
+        vertex.a = 1.0f;
+    }
+
+    // 캐시된 인덱스로 단체를 재구성 (warm start)
+    void ReadCache(const SimplexCache* cache, const ConvexProxy& proxyA,
+                   const ConvexProxy& proxyB)
+    {
+        count = 0;
+        if (cache != nullptr)
+        {
+            for (uint32_t i = 0; i < cache->count; ++i)
+            {
+                if (cache->indexA[i] >= proxyA.count ||
+                    cache->indexB[i] >= proxyB.count)
+                {
+                    count = 0;
+                    break;
+                }
+                SetVertex(v[count++], proxyA, cache->indexA[i], proxyB,
+                          cache->indexB[i]);
+            }
+        }
+
+        // 첫 정점도 지지점으로 잡아야 단체가 민코프스키 차의 경계 위에
+        // 놓이고, 이어지는 EPA 의 다각형이 볼록하게 유지됩니다.
+        if (count == 0)
+        {
+            glm::vec2 d = proxyB.vertices[0] - proxyA.vertices[0];
+            if (glm::dot(d, d) <= 0.0f)
+                d = {1.0f, 0.0f};
+            SetVertex(v[0], proxyA, proxyA.GetSupport(-d), proxyB,
+                      proxyB.GetSupport(d));
+            count = 1;
+        }
+    }
+
+    void WriteCache(SimplexCache* cache) const
+    {
+        if (cache == nullptr)
+            return;
+        cache->count = static_cast<uint8_t>(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            cache->indexA[i] = static_cast<uint8_t>(v[i].indexA);
+            cache->indexB[i] = static_cast<uint8_t>(v[i].indexB);
+        }
+    }
+
+    glm::vec2 GetSearchDirection() const
+    {
+        if (count == 1)
+            return -v[0].w;
+
+        glm::vec2 e12 = v[1].w - v[0].w;
+        if (Cross(e12, -v[0].w) > 0.0f)
+            return {-e12.y, e12.x}; // 원점이 e12 의 왼쪽
+        return {e12.y, -e12.x};
+    }
+
+    void GetWitnessPoints(glm::vec2& pA, glm::vec2& pB) const
+    {
+        switch (count)
+        {
+            case 1:
+                pA = v[0].wA;
+                pB = v[0].wB;
+                break;
+            case 2:
+                pA = v[0].a * v[0].wA + v[1].a * v[1].wA;
+                pB = v[0].a * v[0].wB + v[1].a * v[1].wB;
+                break;
+            default:
+                pA = v[0].a * v[0].wA + v[1].a * v[1].wA + v[2].a * v[2].wA;
+                pB = pA;
+                break;
+        }
+    }
+
+    // 선분에서 원점에 가장 가까운 영역 (Voronoi region)
+    void Solve2()
+    {
+        glm::vec2 w1 = v[0].w;
+        glm::vec2 w2 = v[1].w;
+        glm::vec2 e12 = w2 - w1;
+
+        float d12_2 = -glm::dot(w1, e12);
+        if (d12_2 <= 0.0f)
+        {
+            v[0].a = 1.0f;
+            count = 1;
+            return;
+        }
+
+        float d12_1 = glm::dot(w2, e12);
+        if (d12_1 <= 0.0f)
+        {
+            v[1].a = 1.0f;
+            v[0] = v[1];
+            count = 1;
+            return;
+        }
+
+        float inv = 1.0f / (d12_1 + d12_2);
+        v[0].a = d12_1 * inv;
+        v[1].a = d12_2 * inv;
+        count = 2;
+    }
+
+    // 삼각형에서 원점에 가장 가까운 영역
+    void Solve3()
+    {
+        glm::vec2 w1 = v[0].w;
+        glm::vec2 w2 = v[1].w;
+        glm::vec2 w3 = v[2].w;
+
+        glm::vec2 e12 = w2 - w1;
+        float d12_1 = glm::dot(w2, e12);
+        float d12_2 = -glm::dot(w1, e12);
+
+        glm::vec2 e13 = w3 - w1;
+        float d13_1 = glm::dot(w3, e13);
+        float d13_2 = -glm::dot(w1, e13);
+
+        glm::vec2 e23 = w3 - w2;
+        float d23_1 = glm::dot(w3, e23);
+        float d23_2 = -glm::dot(w2, e23);
+
+        float n123 = Cross(e12, e13);
+        float d123_1 = n123 * Cross(w2, w3);
+        float d123_2 = n123 * Cross(w3, w1);
+        float d123_3 = n123 * Cross(w1, w2);
+
+        if (d12_2 <= 0.0f && d13_2 <= 0.0f)
+        {
+            v[0].a = 1.0f;
+            count = 1;
+            return;
+        }
+        if (d12_1 > 0.0f && d12_2 > 0.0f && d123_3 <= 0.0f)
+        {
+            float inv = 1.0f / (d12_1 + d12_2);
+            v[0].a = d12_1 * inv;
+            v[1].a = d12_2 * inv;
+            count = 2;
+            return;
+        }
+        if (d13_1 > 0.0f && d13_2 > 0.0f && d123_2 <= 0.0f)
+        {
+            float inv = 1.0f / (d13_1 + d13_2);
+            v[0].a = d13_1 * inv;
+            v[2].a = d13_2 * inv;
+            v[1] = v[2];
+            count = 2;
+            return;
+        }
+        if (d12_1 <= 0.0f && d23_2 <= 0.0f)
+        {
+            v[1].a = 1.0f;
+            v[0] = v[1];
+            count = 1;
+            return;
+        }
+        if (d13_1 <= 0.0f && d23_1 <= 0.0f)
+        {
+            v[2].a = 1.0f;
+            v[0] = v[2];
+            count = 1;
+            return;
+        }
+        if (d23_1 > 0.0f && d23_2 > 0.0f && d123_1 <= 0.0f)
+        {
+            float inv = 1.0f / (d23_1 + d23_2);
+            v[1].a = d23_1 * inv;
+            v[2].a = d23_2 * inv;
+            v[0] = v[2];
+            count = 2;
+            return;
+        }
+
+        // 원점이 삼각형 내부
+        float inv = 1.0f / (d123_1 + d123_2 + d123_3);
+        v[0].a = d123_1 * inv;
+        v[1].a = d123_2 * inv;
+        v[2].a = d123_3 * inv;
+        count = 3;
+    }
+};
+
+// 반지름을 제외한 정점 껍질(core) 사이의 GJK. 원점을 포함하면 count == 3
+uint32_t RunGJK(const ConvexProxy& a, const ConvexProxy& b,
+                SimplexCache* cache, Simplex& simplex)
+{
+    simplex.ReadCache(cache, a, b);
+
+    uint32_t iterations = 0;
+    while (iterations < MaxGJKIterations)
+    {
+        uint32_t saveA[3], saveB[3];
+        uint32_t saveCount = simplex.count;
+        for (uint32_t i = 0; i < saveCount; ++i)
+        {
+            saveA[i] = simplex.v[i].indexA;
+            saveB[i] = simplex.v[i].indexB;
+        }
+
+        if (simplex.count == 2)
+            simplex.Solve2();
+        else if (simplex.count == 3)
+            simplex.Solve3();
+
+        if (simplex.count == 3)
+            break;
+
+        glm::vec2 d = simplex.GetSearchDirection();
+        if (glm::dot(d, d) < 1.0e-12f)
+            break; // 원점이 단체 위에 있음 (접촉)
+
+        SimplexVertex& vertex = simplex.v[simplex.count];
+        simplex.SetVertex(vertex, a, a.GetSupport(-d), b, b.GetSupport(d));
+        ++iterations;
+
+        // 이미 있던 지지점이면 더 가까워질 수 없으므로 수렴
+        bool duplicate = false;
+        for (uint32_t i = 0; i < saveCount; ++i)
+        {
+            if (vertex.indexA == saveA[i] && vertex.indexB == saveB[i])
+            {
+                duplicate = true;
+                break;
+            }
+        }
+        if (duplicate)
+            break;
+
+        ++simplex.count;
+    }
+
+    simplex.WriteCache(cache);
+    return iterations;
+}
+
+struct EPAVertex
+{
+    glm::vec2 wA;
+    glm::vec2 wB;
+    glm::vec2 w;
+};
+
+// core 가 겹칠 때 민코프스키 차의 가장 가까운 변을 확장하며 찾습니다.
+// 반환 normal 은 A → B 방향입니다.
+void RunEPA(const ConvexProxy& a, const ConvexProxy& b,
+            const Simplex& simplex, glm::vec2& normal, float& depth,
+            glm::vec2& pointA, glm::vec2& pointB)
+{
+    EPAVertex polytope[MaxEPAVertices];
+    uint32_t count = 3;
+    for (uint32_t i = 0; i < 3; ++i)
+        polytope[i] = {simplex.v[i].wA, simplex.v[i].wB, simplex.v[i].w};
+
+    // 반시계 방향으로 정렬
+    if (Cross(polytope[1].w - polytope[0].w, polytope[2].w - polytope[0].w) <
+        0.0f)
+        std::swap(polytope[1], polytope[2]);
+
+    uint32_t closest = 0;
+    glm::vec2 edgeNormal(0.0f);
+    float edgeDist = 0.0f;
+    while (true)
+    {
+        edgeDist = std::numeric_limits<float>::max();
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            uint32_t j = (i + 1) % count;
+            glm::vec2 e = polytope[j].w - polytope[i].w;
+            float len = glm::length(e);
+            if (len <= 0.0f)
+                continue;
+            glm::vec2 n(e.y / len, -e.x / len);
+            float dist = glm::dot(n, polytope[i].w);
+            if (dist < edgeDist)
+            {
+                edgeDist = dist;
+                edgeNormal = n;
+                closest = i;
+            }
+        }
+
+        EPAVertex s;
+        s.wA = a.vertices[a.GetSupport(-edgeNormal)];
+        s.wB = b.vertices[b.GetSupport(edgeNormal)];
+        s.w = s.wB - s.wA;
+        if (glm::dot(s.w, edgeNormal) - edgeDist < EPATolerance ||
+            count == MaxEPAVertices)
+            break;
+
+        // closest 와 다음 정점 사이에 삽입
+        for (uint32_t k = count; k > closest + 1; --k)
+            polytope[k] = polytope[k - 1];
+        polytope[closest + 1] = s;
+        ++count;
+    }
+
+    const EPAVertex& v1 = polytope[closest];
+    const EPAVertex& v2 = polytope[(closest + 1) % count];
+    glm::vec2 e = v2.w - v1.w;
+    float lenSq = glm::dot(e, e);
+    float t = lenSq > 0.0f
+                  ? std::clamp(-glm::dot(v1.w, e) / lenSq, 0.0f, 1.0f)
+                  : 0.0f;
+
+    // 원점이 차집합 내부이므로 B 를 -edgeNormal 로 밀어야 분리됨
+    normal = -edgeNormal;
+    depth = edgeDist;
+    pointA = v1.wA + (v2.wA - v1.wA) * t;
+    pointB = v1.wB + (v2.wB - v1.wB) * t;
+}
+
+} // namespace
+
+ConvexProxy ConvexProxy::FromCircle(const Circle& circle)
+{
+    ConvexProxy proxy;
+    proxy.vertices[0] = circle.position;
+    proxy.count = 1;
+    proxy.radius = circle.radius;
+    return proxy;
+}
+
+ConvexProxy ConvexProxy::FromAABB(const AABB& box)
+{
+    ConvexProxy proxy;
+    proxy.vertices[0] = box.min;
+    proxy.vertices[1] = {box.max.x, box.min.y};
+    proxy.vertices[2] = box.max;
+    proxy.vertices[3] = {box.min.x, box.max.y};
+    proxy.count = 4;
+    return proxy;
+}
+
+ConvexProxy ConvexProxy::FromOBB(const OBB& box)
+{
+    return FromPolygon(box.GetPolygon(), box.GetTransform());
+}
+
+ConvexProxy ConvexProxy::FromPolygon(const Polygon& polygon,
+                                     const Transform2D& xf)
+{
+    ConvexProxy proxy;
+    for (uint32_t i = 0; i < polygon.count; ++i)
+        proxy.vertices[i] = xf.Apply(polygon.vertices[i]);
+    proxy.count = polygon.count;
+    return proxy;
+}
+
+uint32_t ConvexProxy::GetSupport(const glm::vec2& direction) const
+{
+    uint32_t best = 0;
+    float bestValue = glm::dot(vertices[0], direction);
+    for (uint32_t i = 1; i < count; ++i)
+    {
+        float value = glm::dot(vertices[i], direction);
+        if (value > bestValue)
+        {
+            best = i;
+            bestValue = value;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief 두 볼록 도형 사이의 거리를 GJK 로 계산합니다.
+ *
+ * @param cache 지난 프레임의 단체 (nullptr 가능, 결과로 갱신됨)
+ * @return DistanceOutput 표면 최근접점과 거리 (겹치면 0)
+ */
+DistanceOutput GJKDistance(const ConvexProxy& a, const ConvexProxy& b,
+                           SimplexCache* cache)
+{
+    Simplex simplex;
+    DistanceOutput output;
+    output.iterations = RunGJK(a, b, cache, simplex);
+    simplex.GetWitnessPoints(output.pointA, output.pointB);
+
+    if (simplex.count == 3)
+    {
+        output.distance = 0.0f;
+        return output;
+    }
+
+    glm::vec2 d = output.pointB - output.pointA;
+    float coreDist = glm::length(d);
+    float radii = a.radius + b.radius;
+    if (coreDist > radii && coreDist > 0.0f)
+    {
+        glm::vec2 n = d / coreDist;
+        output.distance = coreDist - radii;
+        output.pointA += n * a.radius;
+        output.pointB -= n * b.radius;
+    }
+    else
+    {
+        glm::vec2 mid = (output.pointA + output.pointB) * 0.5f;
+        output.pointA = mid;
+        output.pointB = mid;
+        output.distance = 0.0f;
+    }
+    return output;
+}
+
+bool GJKOverlap(const ConvexProxy& a, const ConvexProxy& b,
+                SimplexCache* cache)
+{
+    Simplex simplex;
+    RunGJK(a, b, cache, simplex);
+    if (simplex.count == 3)
+        return true;
+
+    glm::vec2 pA, pB;
+    simplex.GetWitnessPoints(pA, pB);
+    float radii = a.radius + b.radius;
+    glm::vec2 d = pB - pA;
+    return glm::dot(d, d) <= radii * radii;
+}
+
+/**
+ * @brief 두 볼록 도형의 접촉 정보를 GJK + EPA 로 계산합니다.
+ *
+ * core 가 떨어져 있으면 GJK 최근접점과 반지름으로, core 가 겹치면
+ * EPA 로 침투 깊이와 법선을 구합니다.
+ *
+ * @return true 충돌하는 경우 (normal: A → B)
+ */
+bool GJKCollide(const ConvexProxy& a, const ConvexProxy& b,
+                ContactManifold& manifold, SimplexCache* cache)
+{
+    const bool warmStarted = cache != nullptr && cache->count > 0;
+    Simplex simplex;
+    RunGJK(a, b, cache, simplex);
+
+    // 캐시된 정점은 이번 프레임에서는 경계 위의 점이 아닐 수 있으므로
+    // EPA 는 지지점만으로 만든 단체에서 다시 시작합니다.
+    if (simplex.count == 3 && warmStarted)
+        RunGJK(a, b, nullptr, simplex);
+
+    const float radii = a.radius + b.radius;
+    glm::vec2 normal, pA, pB;
+    float depth;
+
+    if (simplex.count == 3)
+    {
+        RunEPA(a, b, simplex, normal, depth, pA, pB);
+        depth += radii;
+    }
+    else
+    {
+        simplex.GetWitnessPoints(pA, pB);
+        glm::vec2 d = pB - pA;
+        float coreDistSq = glm::dot(d, d);
+        if (radii * radii < coreDistSq)
+            return false;
+
+        float coreDist = std::sqrt(coreDistSq);
+        if (coreDist > 0.0f)
+        {
+            normal = d / coreDist;
+        }
+        else
+        {
+            // core 가 한 점에서 닿음: 중심 방향을 법선으로 사용
+            glm::vec2 ca(0.0f), cb(0.0f);
+            for (uint32_t i = 0; i < a.count; ++i)
+                ca += a.vertices[i];
+            for (uint32_t i = 0; i < b.count; ++i)
+                cb += b.vertices[i];
+            glm::vec2 centers = cb / float(b.count) - ca / float(a.count);
+            float len = glm::length(centers);
+            normal = len > 0.0f ? centers / len : glm::vec2(1.0f, 0.0f);
+        }
+        depth = radii - coreDist;
+    }
+
+    // 두 표면 점의 중간을 접촉점으로 사용
+    glm::vec2 surfaceA = pA + normal * a.radius;
+    glm::vec2 surfaceB = pB - normal * b.radius;
+    manifold.normal = normal;
+    manifold.penetration = depth;
+    manifold.pointCount = 1;
+    manifold.depths[0] = depth;
+    manifold.points[0] = (surfaceA + surfaceB) * 0.5f;
+    return true;
+}
+
+} // namespace CitadelPhysicsEngine2D
@@ -0,0 +1,198 @@
+#include <CitadelPhysicsEngine2D/collision/Narrowphase.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace CitadelPhysicsEngine2D
+{
+
+/**
+ * @brief 두 원의 접촉 정보를 계산합니다.
+ *
+ * @param a 원 A
+ * @param b 원 B
+ * @param manifold 충돌 시 채워지는 접촉 정보 (normal: A → B)
+ * @return true 충돌하는 경우
+ * @return false 충돌하지 않는 경우
+ */
+bool CollideCircles(const Circle& a, const Circle& b,
+                    ContactManifold& manifold)
+{
+    float r = a.radius + b.radius;
+    glm::vec2 d = b.position - a.position;
+    float distSq = (d.x * d.x) + (d.y * d.y);
+    if ((r * r) < distSq)
+        return false;
+
+    float dist = std::sqrt(distSq);
+    // 중심이 겹치면 임의의 고정 축을 사용
+    manifold.normal = dist > 0.0f ? d / dist : glm::vec2(1.0f, 0.0f);
+    manifold.penetration = r - dist;
+    manifold.pointCount = 1;
+    manifold.depths[0] = manifold.penetration;
+    manifold.points[0] =
+        a.position + manifold.normal * (a.radius - 0.5f * manifold.penetration);
+    return true;
+}
+
+/**
+ * @brief 두 AABB 의 접촉 정보를 계산합니다.
+ *
+ * 겹침이 작은 축을 normal 로 사용하고, 다른 축의 겹침 구간 양 끝을
+ * 접촉점으로 기록합니다.
+ */
+bool CollideAABBs(const AABB& a, const AABB& b, ContactManifold& manifold)
+{
+    glm::vec2 overlapMin = glm::max(a.min, b.min);
+    glm::vec2 overlapMax = glm::min(a.max, b.max);
+    glm::vec2 overlap = overlapMax - overlapMin;
+    if (overlap.x < 0.0f || overlap.y < 0.0f)
+        return false;
+
+    glm::vec2 centerDelta = (b.min + b.max) - (a.min + a.max);
+    glm::vec2 mid = (overlapMin + overlapMax) * 0.5f;
+
+    if (overlap.x < overlap.y)
+    {
+        manifold.normal = {centerDelta.x < 0.0f ? -1.0f : 1.0f, 0.0f};
+        manifold.penetration = overlap.x;
+        manifold.depths[0] = overlap.x;
+        manifold.depths[1] = overlap.x;
+        manifold.points[0] = {mid.x, overlapMin.y};
+        manifold.points[1] = {mid.x, overlapMax.y};
+        manifold.pointCount = overlap.y > 0.0f ? 2 : 1;
+    }
+    else
+    {
+        manifold.normal = {0.0f, centerDelta.y < 0.0f ? -1.0f : 1.0f};
+        manifold.penetration = overlap.y;
+        manifold.depths[0] = overlap.y;
+        manifold.depths[1] = overlap.y;
+        manifold.points[0] = {overlapMin.x, mid.y};
+        manifold.points[1] = {overlapMax.x, mid.y};
+        manifold.pointCount = overlap.x > 0.0f ? 2 : 1;
+    }
+    return true;
+}
+
+/**
+ * @brief 원(A)과 AABB(B)의 접촉 정보를 계산합니다.
+ *
+ * 원의 중심이 AABB 안에 있으면 가장 가까운 면으로 밀어냅니다.
+ */
+bool CollideCircleAABB(const Circle& a, const AABB& b,
+                       ContactManifold& manifold)
+{
+    const glm::vec2 center = a.position;
+    glm::vec2 closest = glm::clamp(center, b.min, b.max);
+    glm::vec2 d = closest - center;
+    float distSq = (d.x * d.x) + (d.y * d.y);
+
+    if (distSq > 0.0f)
+    {
+        if ((a.radius * a.radius) < distSq)
+            return false;
+
+        float dist = std::sqrt(distSq);
+        manifold.normal = d / dist;
+        manifold.penetration = a.radius - dist;
+        manifold.pointCount = 1;
+        manifold.depths[0] = manifold.penetration;
+        manifold.points[0] = closest;
+        return true;
+    }
+
+    // 중심이 상자 내부: 각 면까지의 거리 중 가장 가까운 면
+    float toLeft = center.x - b.min.x;
+    float toRight = b.max.x - center.x;
+    float toBottom = center.y - b.min.y;
+    float toTop = b.max.y - center.y;
+
+    float faceDist = toLeft;
+    glm::vec2 faceNormal(-1.0f, 0.0f);
+    glm::vec2 facePoint(b.min.x, center.y);
+    if (toRight < faceDist)
+    {
+        faceDist = toRight;
+        faceNormal = {1.0f, 0.0f};
+        facePoint = {b.max.x, center.y};
+    }
+    if (toBottom < faceDist)
+    {
+        faceDist = toBottom;
+        faceNormal = {0.0f, -1.0f};
+        facePoint = {center.x, b.min.y};
+    }
+    if (toTop < faceDist)
+    {
+        faceDist = toTop;
+        faceNormal = {0.0f, 1.0f};
+        facePoint = {center.x, b.max.y};
+    }
+
+    // 원은 faceNormal 방향으로 빠져나가야 하므로 B 는 반대로 밀려남
+    manifold.normal = -faceNormal;
+    manifold.penetration = a.radius + faceDist;
+    manifold.pointCount = 1;
+    manifold.depths[0] = manifold.penetration;
+    manifold.points[0] = facePoint;
+    return true;
+}
+
+uint32_t CollideCirclesBatch(const CircleSoA& circles,
+                             const OverlapPair* pairs, uint32_t pairCount,
+                             ContactManifold* outManifolds)
+{
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < pairCount; ++i)
+    {
+        ContactManifold& m = outManifolds[count];
+        if (CollideCircles(circles.Get(pairs[i].a), circles.Get(pairs[i].b),
+                           m))
+        {
+            m.a = pairs[i].a;
+            m.b = pairs[i].b;
+            ++count;
+        }
+    }
+    return count;
+}
+
+uint32_t CollideAABBsBatch(const AABBSoA& boxes, const OverlapPair* pairs,
+                           uint32_t pairCount, ContactManifold* outManifolds)
+{
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < pairCount; ++i)
+    {
+        ContactManifold& m = outManifolds[count];
+        if (CollideAABBs(boxes.Get(pairs[i].a), boxes.Get(pairs[i].b), m))
+        {
+            m.a = pairs[i].a;
+            m.b = pairs[i].b;
+            ++count;
+        }
+    }
+    return count;
+}
+
+uint32_t CollideCircleAABBBatch(const CircleSoA& circles,
+                                const AABBSoA& boxes,
+                                const OverlapPair* pairs, uint32_t pairCount,
+                                ContactManifold* outManifolds)
+{
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < pairCount; ++i)
+    {
+        ContactManifold& m = outManifolds[count];
+        if (CollideCircleAABB(circles.Get(pairs[i].a), boxes.Get(pairs[i].b),
+                              m))
+        {
+            m.a = pairs[i].a;
+            m.b = pairs[i].b;
+            ++count;
+        }
+    }
+    return count;
+}
+
+} // namespace CitadelPhysicsEngine2D
@@ -0,0 +1,184 @@
+#include <CitadelPhysicsEngine2D/collision/SAT.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace CitadelPhysicsEngine2D
+{
+
+namespace
+{
+
+struct WorldPolygon
+{
+    glm::vec2 vertices[Polygon::MaxVertices];
+    glm::vec2 normals[Polygon::MaxVertices];
+    uint32_t count;
+};
+
+void ToWorld(const Polygon& polygon, const Transform2D& xf, WorldPolygon& out)
+{
+    out.count = polygon.count;
+    for (uint32_t i = 0; i < polygon.count; ++i)
+    {
+        out.vertices[i] = xf.Apply(polygon.vertices[i]);
+        out.normals[i] = xf.Rotate(polygon.normals[i]);
+    }
+}
+
+// p1 의 edge 평면에서 p2 의 가장 깊은 정점까지의 거리 (양수 = 분리)
+float EdgeSeparation(const WorldPolygon& p1, uint32_t edge,
+                     const WorldPolygon& p2)
+{
+    const glm::vec2 n = p1.normals[edge];
+    const glm::vec2 v1 = p1.vertices[edge];
+
+    float minDist = std::numeric_limits<float>::max();
+    for (uint32_t j = 0; j < p2.count; ++j)
+        minDist = std::min(minDist, glm::dot(n, p2.vertices[j] - v1));
+    return minDist;
+}
+
+// p1 의 변 법선 중 분리 거리가 가장 큰 축. 양수 분리를 찾으면 바로 반환
+float FindMaxSeparation(const WorldPolygon& p1, const WorldPolygon& p2,
+                        uint32_t& edgeIndex)
+{
+    float maxSeparation = -std::numeric_limits<float>::max();
+    for (uint32_t i = 0; i < p1.count; ++i)
+    {
+        float s = EdgeSeparation(p1, i, p2);
+        if (s > maxSeparation)
+        {
+            maxSeparation = s;
+            edgeIndex = i;
+        }
+        if (s > 0.0f)
+            break;
+    }
+    return maxSeparation;
+}
+
+// dot(normal, p) <= offset 인 부분만 남깁니다.
+uint32_t ClipSegment(const glm::vec2 in[2], glm::vec2 out[2],
+                     const glm::vec2& normal, float offset)
+{
+    uint32_t count = 0;
+    float d0 = glm::dot(normal, in[0]) - offset;
+    float d1 = glm::dot(normal, in[1]) - offset;
+
+    if (d0 <= 0.0f)
+        out[count++] = in[0];
+    if (d1 <= 0.0f)
+        out[count++] = in[1];
+    if (d0 * d1 < 0.0f)
+        out[count++] = in[0] + (in[1] - in[0]) * (d0 / (d0 - d1));
+    return count;
+}
+
+} // namespace
+
+/**
+ * @brief 두 볼록 다각형의 충돌 여부와 접촉 정보를 계산합니다.
+ *
+ * @param cache 쌍별 분리축 캐시 (nullptr 가능)
+ * @return true 충돌하는 경우 (manifold 가 채워짐, normal: A → B)
+ * @return false 분리축이 있는 경우
+ */
+bool CollidePolygons(const Polygon& a, const Transform2D& xfA,
+                     const Polygon& b, const Transform2D& xfB,
+                     ContactManifold& manifold, SATCache* cache)
+{
+    WorldPolygon polyA, polyB;
+    ToWorld(a, xfA, polyA);
+    ToWorld(b, xfB, polyB);
+
+    // 1. 지난 프레임의 분리축 하나만 먼저 검사
+    if (cache != nullptr && cache->valid)
+    {
+        const WorldPolygon& p1 = cache->onB ? polyB : polyA;
+        const WorldPolygon& p2 = cache->onB ? polyA : polyB;
+        if (cache->edge < p1.count &&
+            EdgeSeparation(p1, cache->edge, p2) > 0.0f)
+            return false;
+    }
+
+    // 2. 전체 SAT (첫 분리축에서 종료)
+    uint32_t edgeA = 0;
+    float separationA = FindMaxSeparation(polyA, polyB, edgeA);
+    if (separationA > 0.0f)
+    {
+        if (cache != nullptr)
+            *cache = {1, 0, static_cast<uint8_t>(edgeA)};
+        return false;
+    }
+
+    uint32_t edgeB = 0;
+    float separationB = FindMaxSeparation(polyB, polyA, edgeB);
+    if (separationB > 0.0f)
+    {
+        if (cache != nullptr)
+            *cache = {1, 1, static_cast<uint8_t>(edgeB)};
+        return false;
+    }
+
+    // 3. 기준 변(reference)을 정하고 반대쪽 사건 변(incident)을 클리핑
+    // 비슷한 깊이면 A 를 선호하여 프레임 간 떨림을 줄입니다.
+    const bool flip = separationB > separationA + 1.0e-3f;
+    const WorldPolygon& ref = flip ? polyB : polyA;
+    const WorldPolygon& inc = flip ? polyA : polyB;
+    const uint32_t refEdge = flip ? edgeB : edgeA;
+    if (cache != nullptr)
+        *cache = {1, static_cast<uint8_t>(flip), static_cast<uint8_t>(refEdge)};
+
+    const glm::vec2 refNormal = ref.normals[refEdge];
+    uint32_t incEdge = 0;
+    float minDot = std::numeric_limits<float>::max();
+    for (uint32_t i = 0; i < inc.count; ++i)
+    {
+        float d = glm::dot(refNormal, inc.normals[i]);
+        if (d < minDot)
+        {
+            minDot = d;
+            incEdge = i;
+        }
+    }
+
+    const glm::vec2 r1 = ref.vertices[refEdge];
+    const glm::vec2 r2 = ref.vertices[(refEdge + 1) % ref.count];
+    const glm::vec2 tangent = glm::normalize(r2 - r1);
+
+    glm::vec2 incident[2] = {inc.vertices[incEdge],
+                             inc.vertices[(incEdge + 1) % inc.count]};
+    glm::vec2 clip1[2], clip2[2];
+    if (ClipSegment(incident, clip1, -tangent, -glm::dot(tangent, r1)) < 2)
+        return false;
+    if (ClipSegment(clip1, clip2, tangent, glm::dot(tangent, r2)) < 2)
+        return false;
+
+    manifold.pointCount = 0;
+    manifold.penetration = 0.0f;
+    for (const glm::vec2& p : clip2)
+    {
+        float separation = glm::dot(refNormal, p - r1);
+        if (separation <= 0.0f)
+        {
+            manifold.points[manifold.pointCount] = p;
+            manifold.depths[manifold.pointCount++] = -separation;
+            manifold.penetration = std::max(manifold.penetration, -separation);
+        }
+    }
+    if (manifold.pointCount == 0)
+        return false;
+
+    manifold.normal = flip ? -refNormal : refNormal;
+    return true;
+}
+
+bool CollideOBBs(const OBB& a, const OBB& b, ContactManifold& manifold,
+                 SATCache* cache)
+{
+    return CollidePolygons(a.GetPolygon(), a.GetTransform(), b.GetPolygon(),
+                           b.GetTransform(), manifold, cache);
+}
+
+} // namespace CitadelPhysicsEngine2D
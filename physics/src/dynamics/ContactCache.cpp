@@ -0,0 +1,176 @@
+#include <CitadelPhysicsEngine2D/dynamics/ContactCache.h>
+
+#include <CitadelPhysicsEngine2D/memory/SnapshotBuffer.h>
+
+#include <algorithm>
+
+namespace CitadelPhysicsEngine2D
+{
+
+namespace
+{
+
+constexpr uint32_t MinCapacity = 64;
+
+CachedContact MakeEmpty()
+{
+    CachedContact entry = {};
+    entry.key = ContactCache::EmptyKey;
+    return entry;
+}
+
+} // namespace
+
+/**
+ * @brief 키의 기본 칸 (Fibonacci hashing: 곱한 뒤 상위 비트 사용)
+ */
+uint32_t ContactCache::HomeSlot(uint64_t key) const
+{
+    return static_cast<uint32_t>((key * 0x9E3779B97F4A7C15ull) >> m_Shift);
+}
+
+uint32_t ContactCache::FindSlot(uint64_t key) const
+{
+    const uint32_t capacity = GetCapacity();
+    if (m_Size == 0)
+        return capacity;
+
+    // 부하율이 1/2 이하라 빈 칸이 항상 있으므로 탐사는 끝납니다.
+    const uint32_t mask = capacity - 1;
+    for (uint32_t slot = HomeSlot(key);; slot = (slot + 1) & mask)
+    {
+        const uint64_t stored = m_Entries[slot].key;
+        if (stored == key)
+            return slot;
+        if (stored == EmptyKey)
+            return capacity;
+    }
+}
+
+CachedContact* ContactCache::Find(uint64_t key)
+{
+    const uint32_t slot = FindSlot(key);
+    return slot == GetCapacity() ? nullptr : &m_Entries[slot];
+}
+
+const CachedContact* ContactCache::Find(uint64_t key) const
+{
+    const uint32_t slot = FindSlot(key);
+    return slot == GetCapacity() ? nullptr : &m_Entries[slot];
+}
+
+CachedContact& ContactCache::Insert(uint64_t key, bool& inserted)
+{
+    assert(key != EmptyKey);
+    if ((m_Size + 1) * 2 > GetCapacity())
+        Grow();
+
+    const uint32_t mask = GetCapacity() - 1;
+    uint32_t slot = HomeSlot(key);
+    while (m_Entries[slot].key != EmptyKey)
+    {
+        if (m_Entries[slot].key == key)
+        {
+            inserted = false;
+            return m_Entries[slot];
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    CachedContact& entry = m_Entries[slot];
+    entry = MakeEmpty();
+    entry.key = key;
+    ++m_Size;
+    inserted = true;
+    return entry;
+}
+
+bool ContactCache::Remove(uint64_t key)
+{
+    const uint32_t slot = FindSlot(key);
+    if (slot == GetCapacity())
+        return false;
+    RemoveAt(slot);
+    return true;
+}
+
+/**
+ * @brief 칸을 비우고 뒤따르는 탐사열의 항목을 당겨 빈 칸을 메웁니다.
+ *
+ * 항목 j 의 기본 칸이 빈 칸 hole 과 j 사이(순환 구간 (hole, j])에 있지
+ * 않으면, 그 항목은 hole 을 지나서 탐사된 것이므로 hole 로 옮겨도 찾을 수
+ * 있습니다. 옮긴 자리가 새 빈 칸이 되고, 빈 칸을 만나면 끝납니다.
+ */
+void ContactCache::RemoveAt(uint32_t slot)
+{
+    const uint32_t mask = GetCapacity() - 1;
+    uint32_t hole = slot;
+    for (uint32_t j = (hole + 1) & mask; m_Entries[j].key != EmptyKey;
+         j = (j + 1) & mask)
+    {
+        const uint32_t home = HomeSlot(m_Entries[j].key);
+        // home 이 (hole, j] 안에 있는지 (순환 고려)
+        const bool between = ((home - hole - 1) & mask) < ((j - hole) & mask);
+        if (between)
+            continue;
+        m_Entries[hole] = m_Entries[j];
+        hole = j;
+    }
+    m_Entries[hole] = MakeEmpty();
+    --m_Size;
+}
+
+void ContactCache::Clear()
+{
+    std::fill(m_Entries.begin(), m_Entries.end(), MakeEmpty());
+    m_Size = 0;
+    m_SweepCursor = 0;
+}
+
+/**
+ * @brief 용량을 두 배로 늘리고 모든 항목을 다시 넣습니다.
+ *
+ * 접촉 수가 최대치를 넘을 때만 일어나므로 정상 상태의 스텝에서는 없습니다.
+ */
+void ContactCache::Grow()
+{
+    std::vector<CachedContact> old;
+    old.swap(m_Entries);
+
+    const uint32_t capacity =
+        old.empty() ? MinCapacity : static_cast<uint32_t>(old.size()) * 2;
+    m_Entries.assign(capacity, MakeEmpty());
+    m_Shift = 64;
+    for (uint32_t c = capacity; c > 1; c >>= 1)
+        --m_Shift;
+    m_SweepCursor = 0;
+
+    const uint32_t mask = capacity - 1;
+    for (const CachedContact& entry : old)
+    {
+        if (entry.key == EmptyKey)
+            continue;
+        uint32_t slot = HomeSlot(entry.key);
+        while (m_Entries[slot].key != EmptyKey)
+            slot = (slot + 1) & mask;
+        m_Entries[slot] = entry;
+    }
+}
+
+void ContactCache::SaveState(SnapshotWriter& writer) const
+{
+    writer.Write(m_Size);
+    writer.Write(m_Shift);
+    writer.Write(m_SweepCursor);
+    writer.WriteArray(m_Entries);
+}
+
+void ContactCache::RestoreState(SnapshotReader& reader)
+{
+    reader.Read(m_Size);
+    reader.Read(m_Shift);
+    reader.Read(m_SweepCursor);
+    reader.ReadArray(m_Entries);
+}
+
+} // namespace CitadelPhysicsEngine2D
@@ -0,0 +1,941 @@
+#include <CitadelPhysicsEngine2D/dynamics/ContactSolver.h>
+
+#include <CitadelPhysicsEngine2D/math/Transform2D.h>
+
+#include <CitadelPhysicsEngine2D/math/SimdFloat.h>
+#include <CitadelPhysicsEngine2D/profiling/Profiler.h>
+#include <CitadelPhysicsEngine2D/threading/JobSystem.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace CitadelPhysicsEngine2D
+{
+
+namespace
+{
+
+constexpr float BaumgarteFactor = 0.2f;
+constexpr float LinearSlop = 0.005f;
+constexpr float MaxLinearCorrection = 0.2f;
+constexpr float RestitutionThreshold = 1.0f;
+// 이 거리 안의 지난 스텝 접촉점은 같은 점으로 보고 충격량을 이어받습니다.
+constexpr float WarmStartDistanceSq = 0.05f * 0.05f;
+// 블록 솔버 K 행렬의 조건수 상한. 넘으면 두 점이 사실상 같아 한 점만 사용
+constexpr float MaxConditionNumber = 1000.0f;
+// 접촉이 이보다 적으면 색칠하지 않고 인덱스 순서로 한 번에 풉니다.
+// 색 순서(홀짝 순서)는 높이 쌓인 상자에서 순차 순서보다 수렴이 느리고,
+// 이 정도 크기에서는 병렬화 이득도 없습니다.
+constexpr uint32_t MinColoringConstraints = 128;
+
+glm::vec2 CrossSV(float w, const glm::vec2& r)
+{
+    return {-w * r.y, w * r.x};
+}
+
+float CrossVV(const glm::vec2& a, const glm::vec2& b)
+{
+    return a.x * b.y - a.y * b.x;
+}
+
+// 같은 색의 제약들은 정적 body 를 공유할 수 있으므로 정적 body 에는
+// 쓰지 않습니다. (질량이 0 이라 값도 바뀌지 않음)
+void ApplyImpulse(const SolverBodies& bodies, const ContactConstraint& c,
+                  const glm::vec2& rA, const glm::vec2& rB,
+                  const glm::vec2& impulse)
+{
+    if (c.invMassA > 0.0f)
+    {
+        bodies.velocityX[c.a] -= c.invMassA * impulse.x;
+        bodies.velocityY[c.a] -= c.invMassA * impulse.y;
+        bodies.angularVelocity[c.a] -= c.invInertiaA * CrossVV(rA, impulse);
+    }
+    if (c.invMassB > 0.0f)
+    {
+        bodies.velocityX[c.b] += c.invMassB * impulse.x;
+        bodies.velocityY[c.b] += c.invMassB * impulse.y;
+        bodies.angularVelocity[c.b] += c.invInertiaB * CrossVV(rB, impulse);
+    }
+}
+
+glm::vec2 RelativeVelocity(const SolverBodies& bodies,
+                           const ContactConstraint& c, const glm::vec2& rA,
+                           const glm::vec2& rB)
+{
+    glm::vec2 vA(bodies.velocityX[c.a], bodies.velocityY[c.a]);
+    glm::vec2 vB(bodies.velocityX[c.b], bodies.velocityY[c.b]);
+    return vB + CrossSV(bodies.angularVelocity[c.b], rB) - vA -
+           CrossSV(bodies.angularVelocity[c.a], rA);
+}
+
+// 속도 반복 중 제약 하나가 다루는 두 body 의 속도
+// 아래 식들은 SolveWide 와 연산 순서가 같아야 합니다. (비트 단위 일치)
+struct PairVelocity
+{
+    float vAx, vAy, wA;
+    float vBx, vBy, wB;
+};
+
+PairVelocity LoadVelocity(const SolverBodies& bodies,
+                          const ContactConstraint& c)
+{
+    return {bodies.velocityX[c.a], bodies.velocityY[c.a],
+            bodies.angularVelocity[c.a], bodies.velocityX[c.b],
+            bodies.velocityY[c.b], bodies.angularVelocity[c.b]};
+}
+
+void StoreVelocity(const SolverBodies& bodies, const ContactConstraint& c,
+                   const PairVelocity& v)
+{
+    if (c.invMassA > 0.0f)
+    {
+        bodies.velocityX[c.a] = v.vAx;
+        bodies.velocityY[c.a] = v.vAy;
+        bodies.angularVelocity[c.a] = v.wA;
+    }
+    if (c.invMassB > 0.0f)
+    {
+        bodies.velocityX[c.b] = v.vBx;
+        bodies.velocityY[c.b] = v.vBy;
+        bodies.angularVelocity[c.b] = v.wB;
+    }
+}
+
+void ApplyImpulse(PairVelocity& v, const ContactConstraint& c,
+                  const ContactConstraintPoint& cp, float px, float py)
+{
+    v.vAx = v.vAx - c.invMassA * px;
+    v.vAy = v.vAy - c.invMassA * py;
+    v.wA = v.wA - c.invInertiaA * (cp.rA.x * py - cp.rA.y * px);
+    v.vBx = v.vBx + c.invMassB * px;
+    v.vBy = v.vBy + c.invMassB * py;
+    v.wB = v.wB + c.invInertiaB * (cp.rB.x * py - cp.rB.y * px);
+}
+
+// 접촉점에서의 상대 속도를 방향 (dx, dy) 로 투영
+float RelativeVelocity(const PairVelocity& v, const ContactConstraintPoint& cp,
+                       float dx, float dy)
+{
+    float dvx = ((v.vBx + -v.wB * cp.rB.y) - v.vAx) - -v.wA * cp.rA.y;
+    float dvy = ((v.vBy + v.wB * cp.rB.x) - v.vAy) - v.wA * cp.rA.x;
+    return dvx * dx + dvy * dy;
+}
+
+void SolveFriction(PairVelocity& v, ContactConstraint& c,
+                   ContactConstraintPoint& cp)
+{
+    const float tx = -c.normal.y;
+    const float ty = c.normal.x;
+    float vt = RelativeVelocity(v, cp, tx, ty);
+
+    float lambda = -cp.tangentMass * vt;
+    float maxFriction = c.friction * cp.normalImpulse;
+    float newImpulse =
+        std::clamp(cp.tangentImpulse + lambda, -maxFriction, maxFriction);
+    lambda = newImpulse - cp.tangentImpulse;
+    cp.tangentImpulse = newImpulse;
+    ApplyImpulse(v, c, cp, lambda * tx, lambda * ty);
+}
+
+void SolveNormal(PairVelocity& v, ContactConstraint& c,
+                 ContactConstraintPoint& cp)
+{
+    const float nx = c.normal.x;
+    const float ny = c.normal.y;
+    float vn = RelativeVelocity(v, cp, nx, ny);
+
+    float lambda = -cp.normalMass * (vn - cp.velocityBias);
+    float newImpulse = std::max(cp.normalImpulse + lambda, 0.0f);
+    lambda = newImpulse - cp.normalImpulse;
+    cp.normalImpulse = newImpulse;
+    ApplyImpulse(v, c, cp, lambda * nx, lambda * ny);
+}
+
+/**
+ * @brief 두 접촉점의 법선 제약을 2x2 선형 상보 문제(LCP)로 동시에 풉니다.
+ *
+ * 점을 하나씩 풀면 풀이 순서 때문에 돌림힘이 남아 쌓인 상자가 기웁니다.
+ * 네 가지 경우(둘 다 눌림 / 한쪽만 / 둘 다 떨어짐)를 차례로 시도해
+ * 충격량 >= 0, 상대 속도 >= 0 을 만족하는 해를 고릅니다. (Box2D 방식)
+ */
+void SolveBlock(PairVelocity& v, ContactConstraint& c)
+{
+    ContactConstraintPoint& cp1 = c.points[0];
+    ContactConstraintPoint& cp2 = c.points[1];
+    const float nx = c.normal.x;
+    const float ny = c.normal.y;
+    const glm::mat2& K = c.K;
+    const glm::mat2& M = c.normalMass;
+
+    const float ax = cp1.normalImpulse;
+    const float ay = cp2.normalImpulse;
+    float vn1 = RelativeVelocity(v, cp1, nx, ny);
+    float vn2 = RelativeVelocity(v, cp2, nx, ny);
+    // b = vn - bias - K * a
+    const float bx = (vn1 - cp1.velocityBias) - (K[0][0] * ax + K[1][0] * ay);
+    const float by = (vn2 - cp2.velocityBias) - (K[0][1] * ax + K[1][1] * ay);
+
+    float xx;
+    float xy;
+    for (;;)
+    {
+        // 1. 두 점 모두 접촉
+        xx = -(M[0][0] * bx + M[1][0] * by);
+        xy = -(M[0][1] * bx + M[1][1] * by);
+        if (xx >= 0.0f && xy >= 0.0f)
+            break;
+
+        // 2. 점 1 만 접촉
+        xx = -cp1.normalMass * bx;
+        xy = 0.0f;
+        vn2 = K[0][1] * xx + by;
+        if (xx >= 0.0f && vn2 >= 0.0f)
+            break;
+
+        // 3. 점 2 만 접촉
+        xx = 0.0f;
+        xy = -cp2.normalMass * by;
+        vn1 = K[1][0] * xy + bx;
+        if (xy >= 0.0f && vn1 >= 0.0f)
+            break;
+
+        // 4. 둘 다 분리
+        xx = 0.0f;
+        xy = 0.0f;
+        if (bx >= 0.0f && by >= 0.0f)
+            break;
+
+        // 해가 없으면 (수치 오차) 이번 반복은 건너뜀
+        return;
+    }
+
+    const float dx = xx - ax;
+    const float dy = xy - ay;
+    cp1.normalImpulse = xx;
+    cp2.normalImpulse = xy;
+    ApplyImpulse(v, c, cp1, dx * nx, dx * ny);
+    ApplyImpulse(v, c, cp2, dy * nx, dy * ny);
+}
+
+void SolveConstraint(const SolverBodies& bodies, ContactConstraint& c)
+{
+    PairVelocity v = LoadVelocity(bodies, c);
+    for (uint32_t k = 0; k < c.pointCount; ++k)
+        SolveFriction(v, c, c.points[k]);
+    if (c.pointCount == 1)
+        SolveNormal(v, c, c.points[0]);
+    else
+        SolveBlock(v, c);
+    StoreVelocity(bodies, c, v);
+}
+
+float SolvePosition(const SolverBodies& bodies, const ContactConstraint& c)
+{
+    float minSeparation = 0.0f;
+    const glm::vec2 n = c.normal;
+    for (uint32_t k = 0; k < c.pointCount; ++k)
+    {
+        const ContactConstraintPoint& cp = c.points[k];
+        const Transform2D xfA({bodies.positionX[c.a], bodies.positionY[c.a]},
+                              bodies.angle[c.a]);
+        const Transform2D xfB({bodies.positionX[c.b], bodies.positionY[c.b]},
+                              bodies.angle[c.b]);
+        const glm::vec2 rA = xfA.Rotate(cp.localA);
+        const glm::vec2 rB = xfB.Rotate(cp.localB);
+
+        // 접촉 시점에는 두 앵커가 같은 점이므로 분리 거리 = -depth
+        float separation =
+            glm::dot((xfB.position + rB) - (xfA.position + rA), n) -
+            cp.depth;
+        minSeparation = std::min(minSeparation, separation);
+
+        float C = std::clamp(BaumgarteFactor * (separation + LinearSlop),
+                             -MaxLinearCorrection, 0.0f);
+        float rnA = CrossVV(rA, n);
+        float rnB = CrossVV(rB, n);
+        float K = c.invMassA + c.invMassB + c.invInertiaA * rnA * rnA +
+                  c.invInertiaB * rnB * rnB;
+        if (K <= 0.0f)
+            continue;
+
+        glm::vec2 P = (-C / K) * n;
+        if (c.invMassA > 0.0f)
+        {
+            bodies.positionX[c.a] -= c.invMassA * P.x;
+            bodies.positionY[c.a] -= c.invMassA * P.y;
+            bodies.angle[c.a] -= c.invInertiaA * CrossVV(rA, P);
+        }
+        if (c.invMassB > 0.0f)
+        {
+            bodies.positionX[c.b] += c.invMassB * P.x;
+            bodies.positionY[c.b] += c.invMassB * P.y;
+            bodies.angle[c.b] += c.invInertiaB * CrossVV(rB, P);
+        }
+    }
+    return minSeparation;
+}
+
+#if defined(CPE2D_SIMD_SSE2)
+template <typename F>
+F Clamp(F v, F lo, F hi)
+{
+    // std::clamp 와 같은 비교 순서 (min/max 명령은 ±0 처리가 다름)
+    return Select(Less(v, lo), lo, Select(Less(hi, v), hi, v));
+}
+
+// SolveConstraint 를 F::Width 개 레인에 대해 수행합니다.
+// 레인마다 경로가 다른 곳(점 개수, 블록 솔버의 경우)은 모든 경우를
+// 계산한 뒤 마스크로 고르므로 레인별 결과는 스칼라 경로와 같습니다.
+template <typename F>
+struct WideVelocity
+{
+    F vAx, vAy, wA;
+    F vBx, vBy, wB;
+};
+
+template <typename F>
+struct WideLane
+{
+    WideContactConstraint& g;
+    uint32_t o; // 레인 오프셋
+
+    F Get(const float* p) const { return F::Load(p + o); }
+};
+
+template <typename F>
+WideVelocity<F> Select(F mask, const WideVelocity<F>& a,
+                       const WideVelocity<F>& b)
+{
+    return {Select(mask, a.vAx, b.vAx), Select(mask, a.vAy, b.vAy),
+            Select(mask, a.wA, b.wA),   Select(mask, a.vBx, b.vBx),
+            Select(mask, a.vBy, b.vBy), Select(mask, a.wB, b.wB)};
+}
+
+template <typename F>
+WideVelocity<F> ApplyImpulse(WideVelocity<F> v, const WideLane<F>& l,
+                             uint32_t k, F px, F py)
+{
+    const WideContactConstraint& g = l.g;
+    const F mA = l.Get(g.invMassA);
+    const F mB = l.Get(g.invMassB);
+    v.vAx = v.vAx - mA * px;
+    v.vAy = v.vAy - mA * py;
+    v.wA = v.wA - l.Get(g.invInertiaA) *
+                      (l.Get(g.rAx[k]) * py - l.Get(g.rAy[k]) * px);
+    v.vBx = v.vBx + mB * px;
+    v.vBy = v.vBy + mB * py;
+    v.wB = v.wB + l.Get(g.invInertiaB) *
+                      (l.Get(g.rBx[k]) * py - l.Get(g.rBy[k]) * px);
+    return v;
+}
+
+template <typename F>
+F RelativeVelocity(const WideVelocity<F>& v, const WideLane<F>& l,
+                   uint32_t k, F dx, F dy)
+{
+    const WideContactConstraint& g = l.g;
+    F dvx = ((v.vBx + -v.wB * l.Get(g.rBy[k])) - v.vAx) -
+            -v.wA * l.Get(g.rAy[k]);
+    F dvy = ((v.vBy + v.wB * l.Get(g.rBx[k])) - v.vAy) -
+            v.wA * l.Get(g.rAx[k]);
+    return dvx * dx + dvy * dy;
+}
+
+template <typename F>
+WideVelocity<F> SolveFriction(const WideVelocity<F>& v,
+                              const WideLane<F>& l, uint32_t k)
+{
+    WideContactConstraint& g = l.g;
+    const F tx = -l.Get(g.normalY);
+    const F ty = l.Get(g.normalX);
+    F vt = RelativeVelocity(v, l, k, tx, ty);
+
+    F tangentImpulse = l.Get(g.tangentImpulse[k]);
+    F lambda = -l.Get(g.tangentMass[k]) * vt;
+    F maxFriction = l.Get(g.friction) * l.Get(g.normalImpulse[k]);
+    F newImpulse = Clamp(tangentImpulse + lambda, -maxFriction, maxFriction);
+    lambda = newImpulse - tangentImpulse;
+    newImpulse.Store(g.tangentImpulse[k] + l.o);
+    return ApplyImpulse(v, l, k, lambda * tx, lambda * ty);
+}
+
+template <typename F>
+void SolveWide(const SolverBodies& bodies, WideContactConstraint& g,
+               uint32_t o)
+{
+    const WideLane<F> l{g, o};
+    const uint32_t* ia = g.a + o;
+    const uint32_t* ib = g.b + o;
+    const F zero = F::Zero();
+    const F nx = l.Get(g.normalX);
+    const F ny = l.Get(g.normalY);
+    const F two = GreaterEqual(l.Get(g.pointCount), F::Splat(2.0f));
+
+    WideVelocity<F> v{F::Gather(bodies.velocityX, ia),
+                      F::Gather(bodies.velocityY, ia),
+                      F::Gather(bodies.angularVelocity, ia),
+                      F::Gather(bodies.velocityX, ib),
+                      F::Gather(bodies.velocityY, ib),
+                      F::Gather(bodies.angularVelocity, ib)};
+
+    // 마찰: 점 2 는 두 점 레인에만 반영
+    v = SolveFriction(v, l, 0);
+    {
+        const F oldImpulse = l.Get(g.tangentImpulse[1]);
+        WideVelocity<F> v1 = SolveFriction(v, l, 1);
+        Select(two, l.Get(g.tangentImpulse[1]), oldImpulse)
+            .Store(g.tangentImpulse[1] + o);
+        v = Select(two, v1, v);
+    }
+
+    // 한 점 레인: 법선 제약
+    WideVelocity<F> single;
+    F singleImpulse;
+    {
+        F normalImpulse = l.Get(g.normalImpulse[0]);
+        F vn = RelativeVelocity(v, l, 0, nx, ny);
+        F lambda = -l.Get(g.normalMass[0]) * (vn - l.Get(g.velocityBias[0]));
+        singleImpulse = normalImpulse + lambda;
+        singleImpulse = Select(Less(singleImpulse, zero), zero, singleImpulse);
+        lambda = singleImpulse - normalImpulse;
+        single = ApplyImpulse(v, l, 0, lambda * nx, lambda * ny);
+    }
+
+    // 두 점 레인: 블록 솔버의 네 경우를 모두 계산하고 우선순위대로 선택
+    WideVelocity<F> block;
+    F blockApply;
+    F xx;
+    F xy;
+    {
+        const F ax = l.Get(g.normalImpulse[0]);
+        const F ay = l.Get(g.normalImpulse[1]);
+        const F k01 = l.Get(g.k01);
+        const F k10 = l.Get(g.k10);
+        F vn1 = RelativeVelocity(v, l, 0, nx, ny);
+        F vn2 = RelativeVelocity(v, l, 1, nx, ny);
+        const F bx = (vn1 - l.Get(g.velocityBias[0])) -
+                     (l.Get(g.k00) * ax + k10 * ay);
+        const F by = (vn2 - l.Get(g.velocityBias[1])) -
+                     (k01 * ax + l.Get(g.k11) * ay);
+
+        const F x1x = -(l.Get(g.m00) * bx + l.Get(g.m10) * by);
+        const F x1y = -(l.Get(g.m01) * bx + l.Get(g.m11) * by);
+        const F case1 = And(GreaterEqual(x1x, zero), GreaterEqual(x1y, zero));
+
+        const F x2x = -l.Get(g.normalMass[0]) * bx;
+        const F case2 = And(GreaterEqual(x2x, zero),
+                            GreaterEqual(k01 * x2x + by, zero));
+
+        const F x3y = -l.Get(g.normalMass[1]) * by;
+        const F case3 = And(GreaterEqual(x3y, zero),
+                            GreaterEqual(k10 * x3y + bx, zero));
+
+        const F case4 = And(GreaterEqual(bx, zero), GreaterEqual(by, zero));
+
+        xx = Select(case1, x1x, Select(case2, x2x, zero));
+        xy = Select(case1, x1y, Select(case2, zero, Select(case3, x3y, zero)));
+        blockApply = And(two, Or(Or(case1, case2), Or(case3, case4)));
+
+        const F dx = xx - ax;
+        const F dy = xy - ay;
+        block = ApplyImpulse(v, l, 0, dx * nx, dx * ny);
+        block = ApplyImpulse(block, l, 1, dy * nx, dy * ny);
+        xx = Select(blockApply, xx, ax);
+        xy = Select(blockApply, xy, ay);
+    }
+
+    Select(two, xx, singleImpulse).Store(g.normalImpulse[0] + o);
+    xy.Store(g.normalImpulse[1] + o);
+    v = Select(two, Select(blockApply, block, v), single);
+
+    // 동적 body 에만 되돌려 씁니다.
+    alignas(32) float out[6][F::Width];
+    v.vAx.Store(out[0]);
+    v.vAy.Store(out[1]);
+    v.wA.Store(out[2]);
+    v.vBx.Store(out[3]);
+    v.vBy.Store(out[4]);
+    v.wB.Store(out[5]);
+    for (uint32_t lane = 0; lane < F::Width; ++lane)
+    {
+        if (g.invMassA[o + lane] > 0.0f)
+        {
+            bodies.velocityX[ia[lane]] = out[0][lane];
+            bodies.velocityY[ia[lane]] = out[1][lane];
+            bodies.angularVelocity[ia[lane]] = out[2][lane];
+        }
+        if (g.invMassB[o + lane] > 0.0f)
+        {
+            bodies.velocityX[ib[lane]] = out[3][lane];
+            bodies.velocityY[ib[lane]] = out[4][lane];
+            bodies.angularVelocity[ib[lane]] = out[5][lane];
+        }
+    }
+}
+#endif
+
+void SolveGroup(const SolverBodies& bodies, WideContactConstraint& group,
+                SimdLevel level)
+{
+#if defined(CPE2D_SIMD_AVX2)
+    if (level == SimdLevel::AVX2)
+    {
+        SolveWide<Float8>(bodies, group, 0);
+        return;
+    }
+#endif
+#if defined(CPE2D_SIMD_SSE2)
+    if (level != SimdLevel::Scalar)
+    {
+        SolveWide<Float4>(bodies, group, 0);
+        SolveWide<Float4>(bodies, group, 4);
+        return;
+    }
+#endif
+    (void)bodies;
+    (void)group;
+    (void)level;
+    assert(false && "SIMD 묶음은 SIMD 경로에서만 만들어집니다");
+}
+
+} // namespace
+
+/**
+ * @brief 이번 스텝의 접촉으로 제약 배열을 만듭니다.
+ *
+ * 유효 질량과 반발 바이어스를 미리 계산하고, 캐시에 남은 지난 누적
+ * 충격량을 이어받습니다.
+ *
+ * @param contacts (a, b) 사전순 접촉 목록 (a, b 는 body 배열 인덱스)
+ * @param cacheKeys contacts 와 같은 순서의 캐시 키 (nullptr 이면 a, b)
+ */
+void ContactSolver::Prepare(const ContactManifold* contacts,
+                            uint32_t contactCount,
+                            const SolverBodies& bodies,
+                            const ContactCache* cache,
+                            const uint64_t* cacheKeys)
+{
+    CPE2D_PROFILE_SCOPE("ContactSolver::Prepare");
+    m_Constraints.resize(contactCount);
+
+    for (uint32_t i = 0; i < contactCount; ++i)
+    {
+        const ContactManifold& m = contacts[i];
+        ContactConstraint& c = m_Constraints[i];
+        c.a = m.a;
+        c.b = m.b;
+        c.normal = m.normal;
+        c.friction = std::sqrt(bodies.friction[m.a] * bodies.friction[m.b]);
+        c.invMassA = bodies.invMass[m.a];
+        c.invMassB = bodies.invMass[m.b];
+        c.invInertiaA = bodies.invInertia[m.a];
+        c.invInertiaB = bodies.invInertia[m.b];
+        c.pointCount = m.pointCount;
+
+        const float restitution =
+            std::max(bodies.restitution[m.a], bodies.restitution[m.b]);
+        const Transform2D xfA({bodies.positionX[m.a], bodies.positionY[m.a]},
+                              bodies.angle[m.a]);
+        const Transform2D xfB({bodies.positionX[m.b], bodies.positionY[m.b]},
+                              bodies.angle[m.b]);
+        const glm::vec2 t(-c.normal.y, c.normal.x);
+
+        for (uint32_t k = 0; k < c.pointCount; ++k)
+        {
+            ContactConstraintPoint& cp = c.points[k];
+            cp.point = m.points[k];
+            cp.rA = m.points[k] - xfA.position;
+            cp.rB = m.points[k] - xfB.position;
+            cp.localA = xfA.InvRotate(cp.rA);
+            cp.localB = xfB.InvRotate(cp.rB);
+            cp.depth = m.depths[k];
+            cp.normalImpulse = 0.0f;
+            cp.tangentImpulse = 0.0f;
+
+            float rnA = CrossVV(cp.rA, c.normal);
+            float rnB = CrossVV(cp.rB, c.normal);
+            float kNormal = c.invMassA + c.invMassB +
+                            c.invInertiaA * rnA * rnA +
+                            c.invInertiaB * rnB * rnB;
+            cp.normalMass = kNormal > 0.0f ? 1.0f / kNormal : 0.0f;
+
+            float rtA = CrossVV(cp.rA, t);
+            float rtB = CrossVV(cp.rB, t);
+            float kTangent = c.invMassA + c.invMassB +
+                             c.invInertiaA * rtA * rtA +
+                             c.invInertiaB * rtB * rtB;
+            cp.tangentMass = kTangent > 0.0f ? 1.0f / kTangent : 0.0f;
+
+            // 빠르게 부딪히는 경우에만 반발
+            float vn = glm::dot(RelativeVelocity(bodies, c, cp.rA, cp.rB),
+                                c.normal);
+            cp.velocityBias =
+                vn < -RestitutionThreshold ? -restitution * vn : 0.0f;
+        }
+
+        if (c.pointCount == 2)
+        {
+            const ContactConstraintPoint& cp1 = c.points[0];
+            const ContactConstraintPoint& cp2 = c.points[1];
+            float rn1A = CrossVV(cp1.rA, c.normal);
+            float rn1B = CrossVV(cp1.rB, c.normal);
+            float rn2A = CrossVV(cp2.rA, c.normal);
+            float rn2B = CrossVV(cp2.rB, c.normal);
+            float mSum = c.invMassA + c.invMassB;
+            float k11 = mSum + c.invInertiaA * rn1A * rn1A +
+                        c.invInertiaB * rn1B * rn1B;
+            float k22 = mSum + c.invInertiaA * rn2A * rn2A +
+                        c.invInertiaB * rn2B * rn2B;
+            float k12 = mSum + c.invInertiaA * rn1A * rn2A +
+                        c.invInertiaB * rn1B * rn2B;
+
+            if (k11 * k11 < MaxConditionNumber * (k11 * k22 - k12 * k12))
+            {
+                c.K = glm::mat2(k11, k12, k12, k22);
+                c.normalMass = glm::inverse(c.K);
+            }
+            else
+            {
+                c.pointCount = 1;
+            }
+        }
+
+        if (m_WarmStarting == false || cache == nullptr)
+            continue;
+        const CachedContact* cached =
+            cache->Find(cacheKeys != nullptr ? cacheKeys[i]
+                                             : ContactCache::MakeKey(c.a, c.b));
+        if (cached != nullptr)
+            MatchCachedImpulses(c, *cached);
+    }
+
+    BuildColors();
+}
+
+/**
+ * @brief 캐시된 접촉점 중 가까운 점의 충격량을 복사합니다.
+ */
+void ContactSolver::MatchCachedImpulses(ContactConstraint& constraint,
+                                        const CachedContact& cached)
+{
+    for (uint32_t k = 0; k < constraint.pointCount; ++k)
+    {
+        ContactConstraintPoint& cp = constraint.points[k];
+        for (uint32_t j = 0; j < cached.pointCount; ++j)
+        {
+            glm::vec2 d = cp.point - cached.points[j];
+            if (glm::dot(d, d) < WarmStartDistanceSq)
+            {
+                cp.normalImpulse = cached.normalImpulses[j];
+                cp.tangentImpulse = cached.tangentImpulses[j];
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * @brief 제약 그래프를 색칠하고 색 순서대로 묶습니다.
+ *
+ * 제약을 인덱스 순서로 보며 두 동적 body 가 아직 쓰지 않은 가장 작은 색을
+ * 줍니다. 정적 body 는 쓰이지 않으므로 공유해도 됩니다. 색칠 결과는 제약
+ * 순서와 개수에만 의존하므로 스레드 수나 SIMD 경로와 관계없이 같습니다.
+ */
+void ContactSolver::BuildColors()
+{
+    const uint32_t count = static_cast<uint32_t>(m_Constraints.size());
+    uint32_t bodyCount = 0;
+    for (const ContactConstraint& c : m_Constraints)
+        bodyCount = std::max(bodyCount, std::max(c.a, c.b) + 1);
+    m_BodyColors.assign(bodyCount, 0);
+    m_ConstraintColors.resize(count);
+
+    // 색 MaxColors 는 넘친 제약
+    uint32_t colorCounts[MaxColors + 1] = {};
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        const ContactConstraint& c = m_Constraints[i];
+        const bool dynamicA = c.invMassA > 0.0f;
+        const bool dynamicB = c.invMassB > 0.0f;
+        uint64_t used = count < MinColoringConstraints ? ~uint64_t(0) : 0;
+        if (dynamicA)
+            used |= m_BodyColors[c.a];
+        if (dynamicB)
+            used |= m_BodyColors[c.b];
+
+        uint32_t color = MaxColors;
+        if (used != ~uint64_t(0))
+        {
+            color = CountTrailingZeros(~used);
+            const uint64_t bit = uint64_t(1) << color;
+            if (dynamicA)
+                m_BodyColors[c.a] |= bit;
+            if (dynamicB)
+                m_BodyColors[c.b] |= bit;
+        }
+        m_ConstraintColors[i] = static_cast<uint8_t>(color);
+        ++colorCounts[color];
+    }
+
+    // 색별 계수 정렬 (같은 색 안에서는 인덱스 순서 유지)
+    uint32_t offsets[MaxColors + 1];
+    uint32_t offset = 0;
+    for (uint32_t color = 0; color <= MaxColors; ++color)
+    {
+        offsets[color] = offset;
+        offset += colorCounts[color];
+    }
+    m_ColorOrder.resize(count);
+    for (uint32_t i = 0; i < count; ++i)
+        m_ColorOrder[offsets[m_ConstraintColors[i]]++] = i;
+
+    m_GroupLevel = m_SimdLevel;
+    m_Colors.clear();
+    m_Groups.clear();
+    const uint32_t lanes = WideContactConstraint::LaneCount;
+    for (uint32_t color = 0; color <= MaxColors; ++color)
+    {
+        if (colorCounts[color] == 0)
+            continue;
+
+        ColorBatch batch;
+        batch.count = colorCounts[color];
+        batch.first = offsets[color] - batch.count;
+        batch.firstGroup = static_cast<uint32_t>(m_Groups.size());
+        batch.groupCount = 0;
+        batch.serial = color == MaxColors;
+        if (batch.serial == false && m_GroupLevel != SimdLevel::Scalar)
+            batch.groupCount = batch.count / lanes;
+
+        m_Groups.resize(batch.firstGroup + batch.groupCount);
+        for (uint32_t k = 0; k < batch.groupCount; ++k)
+        {
+            PackGroup(m_Groups[batch.firstGroup + k],
+                      m_ColorOrder.data() + batch.first + k * lanes);
+        }
+        m_Colors.push_back(batch);
+    }
+}
+
+/**
+ * @brief 제약 8 개를 레인별 배열로 옮깁니다. 한 점 제약의 두 번째 점과
+ *        블록 행렬은 0 으로 채워 버려질 계산에서도 NaN 이 나오지 않게 합니다.
+ */
+void ContactSolver::PackGroup(WideContactConstraint& group,
+                              const uint32_t* indices) const
+{
+    group = {};
+    for (uint32_t lane = 0; lane < WideContactConstraint::LaneCount; ++lane)
+    {
+        const ContactConstraint& c = m_Constraints[indices[lane]];
+        group.index[lane] = indices[lane];
+        group.a[lane] = c.a;
+        group.b[lane] = c.b;
+        group.normalX[lane] = c.normal.x;
+        group.normalY[lane] = c.normal.y;
+        group.friction[lane] = c.friction;
+        group.invMassA[lane] = c.invMassA;
+        group.invMassB[lane] = c.invMassB;
+        group.invInertiaA[lane] = c.invInertiaA;
+        group.invInertiaB[lane] = c.invInertiaB;
+        group.pointCount[lane] = static_cast<float>(c.pointCount);
+
+        for (uint32_t k = 0; k < c.pointCount; ++k)
+        {
+            const ContactConstraintPoint& cp = c.points[k];
+            group.rAx[k][lane] = cp.rA.x;
+            group.rAy[k][lane] = cp.rA.y;
+            group.rBx[k][lane] = cp.rB.x;
+            group.rBy[k][lane] = cp.rB.y;
+            group.normalImpulse[k][lane] = cp.normalImpulse;
+            group.tangentImpulse[k][lane] = cp.tangentImpulse;
+            group.normalMass[k][lane] = cp.normalMass;
+            group.tangentMass[k][lane] = cp.tangentMass;
+            group.velocityBias[k][lane] = cp.velocityBias;
+        }
+        if (c.pointCount == 2)
+        {
+            group.k00[lane] = c.K[0][0];
+            group.k01[lane] = c.K[0][1];
+            group.k10[lane] = c.K[1][0];
+            group.k11[lane] = c.K[1][1];
+            group.m00[lane] = c.normalMass[0][0];
+            group.m01[lane] = c.normalMass[0][1];
+            group.m10[lane] = c.normalMass[1][0];
+            group.m11[lane] = c.normalMass[1][1];
+        }
+    }
+}
+
+/**
+ * @brief 색 묶음마다 항목 범위를 작업으로 나눠 실행합니다.
+ *
+ * 색 사이에는 JobSystem::ParallelFor 가 끝날 때까지 기다리므로 다음 색은 앞 색의
+ * 결과를 봅니다. 작업량은 SIMD 묶음 하나를 제약 8 개로 세어 나눕니다.
+ * 작은 색과 넘친 제약은 호출 스레드에서 바로 풉니다.
+ */
+template <typename Task>
+void ContactSolver::ForEachColor(const Task& task)
+{
+    constexpr uint32_t MinConstraintsPerTask = 64;
+    const uint32_t lanes = WideContactConstraint::LaneCount;
+    const uint32_t threadCount =
+        m_JobSystem != nullptr ? m_JobSystem->GetThreadCount() : 1;
+
+    for (const ColorBatch& batch : m_Colors)
+    {
+        const uint32_t itemCount =
+            batch.groupCount + (batch.count - batch.groupCount * lanes);
+        const uint32_t taskCount =
+            batch.serial ? 1
+                         : std::max(1u, std::min(threadCount,
+                                                 batch.count /
+                                                     MinConstraintsPerTask));
+        if (taskCount == 1)
+        {
+            task(batch, 0u, 0u, itemCount);
+            continue;
+        }
+
+        // 제약 단위 위치 → 항목 인덱스
+        const uint32_t groupWork = batch.groupCount * lanes;
+        auto itemAt = [&](uint32_t work)
+        {
+            return work <= groupWork ? work / lanes
+                                     : batch.groupCount + (work - groupWork);
+        };
+        m_JobSystem->ParallelFor(
+            taskCount, 1,
+            [&](uint32_t begin, uint32_t end)
+            {
+                uint64_t total = batch.count;
+                for (uint32_t slot = begin; slot < end; ++slot)
+                {
+                    uint32_t first = itemAt(
+                        static_cast<uint32_t>(total * slot / taskCount));
+                    uint32_t last = itemAt(
+                        static_cast<uint32_t>(total * (slot + 1) / taskCount));
+                    task(batch, slot, first, last);
+                }
+            });
+    }
+}
+
+/**
+ * @brief 색 안의 항목 번호를 m_ColorOrder 상의 위치로 바꿉니다.
+ */
+uint32_t ContactSolver::ItemOffset(const ColorBatch& batch, uint32_t item)
+{
+    const uint32_t lanes = WideContactConstraint::LaneCount;
+    return item <= batch.groupCount
+               ? item * lanes
+               : batch.groupCount * lanes + (item - batch.groupCount);
+}
+
+void ContactSolver::WarmStart(const SolverBodies& bodies)
+{
+    CPE2D_PROFILE_SCOPE("ContactSolver::WarmStart");
+    // 묶음 안의 제약도 m_Constraints 의 값으로 스칼라 경로에서 적용합니다.
+    ForEachColor(
+        [&](const ColorBatch& batch, uint32_t, uint32_t first, uint32_t last)
+        {
+            const uint32_t end = ItemOffset(batch, last);
+            for (uint32_t i = ItemOffset(batch, first); i < end; ++i)
+            {
+                const ContactConstraint& c =
+                    m_Constraints[m_ColorOrder[batch.first + i]];
+                const glm::vec2 t(-c.normal.y, c.normal.x);
+                for (uint32_t k = 0; k < c.pointCount; ++k)
+                {
+                    const ContactConstraintPoint& cp = c.points[k];
+                    glm::vec2 impulse =
+                        cp.normalImpulse * c.normal + cp.tangentImpulse * t;
+                    ApplyImpulse(bodies, c, cp.rA, cp.rB, impulse);
+                }
+            }
+        });
+}
+
+/**
+ * @brief 속도 제약을 한 번 순회합니다. (반복 횟수만큼 호출)
+ *
+ * 누적 충격량을 자르는 방식이라 한 반복에서 과하게 민 충격량을 다음
+ * 반복에서 되돌릴 수 있습니다. 마찰은 현재 법선 누적 충격량의 쿨롱 원뿔로
+ * 제한합니다.
+ */
+void ContactSolver::SolveVelocities(const SolverBodies& bodies)
+{
+    CPE2D_PROFILE_SCOPE("ContactSolver::SolveVelocities");
+    ForEachColor(
+        [&](const ColorBatch& batch, uint32_t, uint32_t first, uint32_t last)
+        {
+            for (uint32_t item = first; item < last; ++item)
+            {
+                if (item < batch.groupCount)
+                {
+                    SolveGroup(bodies, m_Groups[batch.firstGroup + item],
+                               m_GroupLevel);
+                    continue;
+                }
+                uint32_t i = ItemOffset(batch, item);
+                SolveConstraint(bodies,
+                                m_Constraints[m_ColorOrder[batch.first + i]]);
+            }
+        });
+}
+
+void ContactSolver::StoreImpulses()
+{
+    for (const WideContactConstraint& group : m_Groups)
+    {
+        for (uint32_t lane = 0; lane < WideContactConstraint::LaneCount;
+             ++lane)
+        {
+            ContactConstraint& c = m_Constraints[group.index[lane]];
+            for (uint32_t k = 0; k < c.pointCount; ++k)
+            {
+                c.points[k].normalImpulse = group.normalImpulse[k][lane];
+                c.points[k].tangentImpulse = group.tangentImpulse[k][lane];
+            }
+        }
+    }
+}
+
+/**
+ * @brief 위치 단계: 남은 침투를 위치/각도로 직접 밀어냅니다.
+ *
+ * 접촉점을 각 body 의 로컬 좌표로 기억해 두었다가 현재 변환으로 다시
+ * 계산한 분리 거리로 보정합니다. 속도를 건드리지 않으므로 보정에 쓴
+ * 에너지가 다음 스텝의 튐으로 남지 않습니다.
+ */
+bool ContactSolver::SolvePositions(const SolverBodies& bodies)
+{
+    CPE2D_PROFILE_SCOPE("ContactSolver::SolvePositions");
+    const uint32_t threadCount =
+        m_JobSystem != nullptr ? m_JobSystem->GetThreadCount() : 1;
+    m_TaskSeparations.assign(threadCount, 0.0f);
+
+    ForEachColor(
+        [&](const ColorBatch& batch, uint32_t slot, uint32_t first,
+            uint32_t last)
+        {
+            float minSeparation = m_TaskSeparations[slot];
+            const uint32_t end = ItemOffset(batch, last);
+            for (uint32_t i = ItemOffset(batch, first); i < end; ++i)
+            {
+                const ContactConstraint& c =
+                    m_Constraints[m_ColorOrder[batch.first + i]];
+                minSeparation =
+                    std::min(minSeparation, SolvePosition(bodies, c));
+            }
+            m_TaskSeparations[slot] = minSeparation;
+        });
+
+    float minSeparation = 0.0f;
+    for (float separation : m_TaskSeparations)
+        minSeparation = std::min(minSeparation, separation);
+    return minSeparation >= -3.0f * LinearSlop;
+}
+
+} // namespace CitadelPhysicsEngine2D
@@ -0,0 +1,679 @@
+#include <CitadelPhysicsEngine2D/dynamics/ParticleSystem.h>
+
+#include <CitadelPhysicsEngine2D/math/SimdFloat.h>
+#include <CitadelPhysicsEngine2D/profiling/Profiler.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace CitadelPhysicsEngine2D
+{
+
+// 커널이 읽고 쓰는 입자 SoA 배열
+struct ParticleArrays
+{
+    float* positionX;
+    float* positionY;
+    float* previousX;
+    float* previousY;
+    float* velocityX;
+    float* velocityY;
+    const float* invMass;
+    const float* radius;
+};
+
+namespace
+{
+
+// 스칼라 커널과 SIMD 커널은 같은 식을 같은 순서로 계산합니다. (FMA 미사용)
+// 분기는 SIMD 쪽에서 마스크 Select 로 바뀝니다.
+
+float TriangleArea(float ax, float ay, float bx, float by, float cx, float cy)
+{
+    return 0.5f * ((bx - ax) * (cy - ay) - (by - ay) * (cx - ax));
+}
+
+void IntegrateParticle(const ParticleArrays& p, uint32_t i, float dvx,
+                       float dvy, float h)
+{
+    p.previousX[i] = p.positionX[i];
+    p.previousY[i] = p.positionY[i];
+    if (p.invMass[i] == 0.0f)
+        return;
+
+    p.velocityX[i] = p.velocityX[i] + dvx;
+    p.velocityY[i] = p.velocityY[i] + dvy;
+    p.positionX[i] = p.positionX[i] + p.velocityX[i] * h;
+    p.positionY[i] = p.positionY[i] + p.velocityY[i] * h;
+}
+
+void UpdateVelocity(const ParticleArrays& p, uint32_t i, float invH)
+{
+    p.velocityX[i] = (p.positionX[i] - p.previousX[i]) * invH;
+    p.velocityY[i] = (p.positionY[i] - p.previousY[i]) * invH;
+}
+
+/**
+ * @brief 정적 도형 밖으로 밀어내고 substep 동안의 접선 이동을 줄입니다.
+ */
+void ApplyContact(const ParticleArrays& p, uint32_t i, float nx, float ny,
+                  float depth, float friction)
+{
+    float x = p.positionX[i] + nx * depth;
+    float y = p.positionY[i] + ny * depth;
+    const float mx = x - p.previousX[i];
+    const float my = y - p.previousY[i];
+    const float mn = mx * nx + my * ny;
+    p.positionX[i] = x - (mx - nx * mn) * friction;
+    p.positionY[i] = y - (my - ny * mn) * friction;
+}
+
+void CollideCircle(const ParticleArrays& p, uint32_t i, float cx, float cy,
+                   float cr, float friction)
+{
+    if (p.invMass[i] == 0.0f)
+        return;
+
+    const float dx = p.positionX[i] - cx;
+    const float dy = p.positionY[i] - cy;
+    const float r = cr + p.radius[i];
+    const float distSq = dx * dx + dy * dy;
+    // 중심이 정확히 겹치면 밀어낼 방향이 없으므로 건너뜁니다.
+    if ((distSq < r * r) == false || distSq == 0.0f)
+        return;
+
+    const float dist = std::sqrt(distSq);
+    ApplyContact(p, i, dx / dist, dy / dist, r - dist, friction);
+}
+
+void CollideBox(const ParticleArrays& p, uint32_t i, const AABB& box,
+                float friction)
+{
+    if (p.invMass[i] == 0.0f)
+        return;
+
+    const float x = p.positionX[i];
+    const float y = p.positionY[i];
+    const float r = p.radius[i];
+    const float dx = x - std::min(std::max(x, box.min.x), box.max.x);
+    const float dy = y - std::min(std::max(y, box.min.y), box.max.y);
+    const float distSq = dx * dx + dy * dy;
+    if (distSq > 0.0f)
+    {
+        // 중심이 상자 밖: 가장 가까운 점에서 반지름만큼 떨어뜨림
+        if ((distSq < r * r) == false)
+            return;
+        const float dist = std::sqrt(distSq);
+        ApplyContact(p, i, dx / dist, dy / dist, r - dist, friction);
+        return;
+    }
+
+    // 중심이 상자 안: 가장 가까운 면 밖으로
+    float depth = x - box.min.x;
+    float nx = -1.0f;
+    float ny = 0.0f;
+    const float right = box.max.x - x;
+    if (right < depth)
+    {
+        depth = right;
+        nx = 1.0f;
+        ny = 0.0f;
+    }
+    const float bottom = y - box.min.y;
+    if (bottom < depth)
+    {
+        depth = bottom;
+        nx = 0.0f;
+        ny = -1.0f;
+    }
+    const float top = box.max.y - y;
+    if (top < depth)
+    {
+        depth = top;
+        nx = 0.0f;
+        ny = 1.0f;
+    }
+    ApplyContact(p, i, nx, ny, depth + r, friction);
+}
+
+#if defined(CPE2D_SIMD_SSE2) || defined(CPE2D_SIMD_AVX2)
+// 아래 커널은 Width 의 배수까지만 처리하고 처리한 개수를 반환합니다.
+// 나머지는 호출자가 스칼라 커널로 처리합니다.
+
+template <typename F>
+uint32_t IntegrateWide(const ParticleArrays& p, uint32_t count, float dvx,
+                       float dvy, float h)
+{
+    const uint32_t end = count - count % F::Width;
+    const F zero = F::Zero();
+    const F wdvx = F::Splat(dvx);
+    const F wdvy = F::Splat(dvy);
+    const F wh = F::Splat(h);
+    for (uint32_t i = 0; i < end; i += F::Width)
+    {
+        F x = F::Load(p.positionX + i);
+        F y = F::Load(p.positionY + i);
+        x.Store(p.previousX + i);
+        y.Store(p.previousY + i);
+
+        const F dynamic = Less(zero, F::Load(p.invMass + i));
+        F vx = F::Load(p.velocityX + i);
+        F vy = F::Load(p.velocityY + i);
+        vx = Select(dynamic, vx + wdvx, vx);
+        vy = Select(dynamic, vy + wdvy, vy);
+        vx.Store(p.velocityX + i);
+        vy.Store(p.velocityY + i);
+        Select(dynamic, x + vx * wh, x).Store(p.positionX + i);
+        Select(dynamic, y + vy * wh, y).Store(p.positionY + i);
+    }
+    return end;
+}
+
+template <typename F>
+uint32_t UpdateVelocitiesWide(const ParticleArrays& p, uint32_t count,
+                              float invH)
+{
+    const uint32_t end = count - count % F::Width;
+    const F winvH = F::Splat(invH);
+    for (uint32_t i = 0; i < end; i += F::Width)
+    {
+        F vx = (F::Load(p.positionX + i) - F::Load(p.previousX + i)) * winvH;
+        F vy = (F::Load(p.positionY + i) - F::Load(p.previousY + i)) * winvH;
+        vx.Store(p.velocityX + i);
+        vy.Store(p.velocityY + i);
+    }
+    return end;
+}
+
+template <typename F>
+void ApplyContactWide(const ParticleArrays& p, uint32_t i, F mask, F nx, F ny,
+                      F depth, F friction)
+{
+    const F oldX = F::Load(p.positionX + i);
+    const F oldY = F::Load(p.positionY + i);
+    const F x = oldX + nx * depth;
+    const F y = oldY + ny * depth;
+    const F mx = x - F::Load(p.previousX + i);
+    const F my = y - F::Load(p.previousY + i);
+    const F mn = mx * nx + my * ny;
+    Select(mask, x - (mx - nx * mn) * friction, oldX).Store(p.positionX + i);
+    Select(mask, y - (my - ny * mn) * friction, oldY).Store(p.positionY + i);
+}
+
+template <typename F>
+uint32_t CollideCircleWide(const ParticleArrays& p, uint32_t count, float cx,
+                           float cy, float cr, float friction)
+{
+    const uint32_t end = count - count % F::Width;
+    const F zero = F::Zero();
+    const F wcx = F::Splat(cx);
+    const F wcy = F::Splat(cy);
+    const F wcr = F::Splat(cr);
+    const F wfriction = F::Splat(friction);
+    for (uint32_t i = 0; i < end; i += F::Width)
+    {
+        const F dx = F::Load(p.positionX + i) - wcx;
+        const F dy = F::Load(p.positionY + i) - wcy;
+        const F r = wcr + F::Load(p.radius + i);
+        const F distSq = dx * dx + dy * dy;
+        const F mask = And(And(Less(distSq, r * r), Less(zero, distSq)),
+                           Less(zero, F::Load(p.invMass + i)));
+        if (MoveMask(mask) == 0)
+            continue;
+
+        const F dist = Sqrt(distSq);
+        ApplyContactWide(p, i, mask, dx / dist, dy / dist, r - dist,
+                         wfriction);
+    }
+    return end;
+}
+
+template <typename F>
+uint32_t CollideBoxWide(const ParticleArrays& p, uint32_t count,
+                        const AABB& box, float friction)
+{
+    const uint32_t end = count - count % F::Width;
+    const F zero = F::Zero();
+    const F one = F::Splat(1.0f);
+    const F minX = F::Splat(box.min.x);
+    const F minY = F::Splat(box.min.y);
+    const F maxX = F::Splat(box.max.x);
+    const F maxY = F::Splat(box.max.y);
+    const F wfriction = F::Splat(friction);
+    for (uint32_t i = 0; i < end; i += F::Width)
+    {
+        const F x = F::Load(p.positionX + i);
+        const F y = F::Load(p.positionY + i);
+        const F r = F::Load(p.radius + i);
+        const F dx = x - Min(Max(x, minX), maxX);
+        const F dy = y - Min(Max(y, minY), maxY);
+        const F distSq = dx * dx + dy * dy;
+        const F outside = Less(zero, distSq);
+        const F inside = GreaterEqual(zero, distSq);
+        const F touching = Or(Less(distSq, r * r), inside);
+        const F mask = And(touching, Less(zero, F::Load(p.invMass + i)));
+        if (MoveMask(mask) == 0)
+            continue;
+
+        // 밖: 가장 가까운 점 방향
+        const F dist = Sqrt(distSq);
+        const F outNx = dx / dist;
+        const F outNy = dy / dist;
+        const F outDepth = r - dist;
+
+        // 안: 가장 가까운 면 방향 (스칼라와 같은 순서로 갱신)
+        F depth = x - minX;
+        F nx = -one;
+        F ny = zero;
+        const F right = maxX - x;
+        F closer = Less(right, depth);
+        depth = Select(closer, right, depth);
+        nx = Select(closer, one, nx);
+        ny = Select(closer, zero, ny);
+        const F bottom = y - minY;
+        closer = Less(bottom, depth);
+        depth = Select(closer, bottom, depth);
+        nx = Select(closer, zero, nx);
+        ny = Select(closer, -one, ny);
+        const F top = maxY - y;
+        closer = Less(top, depth);
+        depth = Select(closer, top, depth);
+        nx = Select(closer, zero, nx);
+        ny = Select(closer, one, ny);
+
+        ApplyContactWide(p, i, mask, Select(outside, outNx, nx),
+                         Select(outside, outNy, ny),
+                         Select(outside, outDepth, depth + r), wfriction);
+    }
+    return end;
+}
+#endif
+
+} // namespace
+
+ParticleSystem::ParticleSystem(const glm::vec2& gravity) : m_Gravity(gravity)
+{
+}
+
+uint32_t ParticleSystem::CreateParticle(const ParticleDef& def)
+{
+    assert(def.mass >= 0.0f && def.radius >= 0.0f);
+    const uint32_t index = GetParticleCount();
+    m_PositionX.push_back(def.position.x);
+    m_PositionY.push_back(def.position.y);
+    m_PreviousX.push_back(def.position.x);
+    m_PreviousY.push_back(def.position.y);
+    m_VelocityX.push_back(def.mass > 0.0f ? def.velocity.x : 0.0f);
+    m_VelocityY.push_back(def.mass > 0.0f ? def.velocity.y : 0.0f);
+    m_InvMass.push_back(def.mass > 0.0f ? 1.0f / def.mass : 0.0f);
+    m_Radius.push_back(def.radius);
+    return index;
+}
+
+void ParticleSystem::Clear()
+{
+    m_PositionX.clear();
+    m_PositionY.clear();
+    m_PreviousX.clear();
+    m_PreviousY.clear();
+    m_VelocityX.clear();
+    m_VelocityY.clear();
+    m_InvMass.clear();
+    m_Radius.clear();
+
+    m_DistanceA.clear();
+    m_DistanceB.clear();
+    m_DistanceRest.clear();
+    m_DistanceCompliance.clear();
+
+    m_AreaA.clear();
+    m_AreaB.clear();
+    m_AreaC.clear();
+    m_AreaRest.clear();
+    m_AreaCompliance.clear();
+
+    m_ParticlePairs.clear();
+}
+
+void ParticleSystem::Reserve(size_t capacity)
+{
+    m_PositionX.reserve(capacity);
+    m_PositionY.reserve(capacity);
+    m_PreviousX.reserve(capacity);
+    m_PreviousY.reserve(capacity);
+    m_VelocityX.reserve(capacity);
+    m_VelocityY.reserve(capacity);
+    m_InvMass.reserve(capacity);
+    m_Radius.reserve(capacity);
+    m_SweptParticles.Reserve(capacity);
+}
+
+uint32_t ParticleSystem::AddDistanceConstraint(uint32_t a, uint32_t b,
+                                               float compliance)
+{
+    assert(a < GetParticleCount() && b < GetParticleCount() && a != b);
+    const float dx = m_PositionX[b] - m_PositionX[a];
+    const float dy = m_PositionY[b] - m_PositionY[a];
+    m_DistanceA.push_back(a);
+    m_DistanceB.push_back(b);
+    m_DistanceRest.push_back(std::sqrt(dx * dx + dy * dy));
+    m_DistanceCompliance.push_back(compliance);
+    return static_cast<uint32_t>(m_DistanceA.size() - 1);
+}
+
+uint32_t ParticleSystem::AddAreaConstraint(uint32_t a, uint32_t b, uint32_t c,
+                                           float compliance)
+{
+    assert(a < GetParticleCount() && b < GetParticleCount() &&
+           c < GetParticleCount());
+    m_AreaA.push_back(a);
+    m_AreaB.push_back(b);
+    m_AreaC.push_back(c);
+    m_AreaRest.push_back(TriangleArea(m_PositionX[a], m_PositionY[a],
+                                      m_PositionX[b], m_PositionY[b],
+                                      m_PositionX[c], m_PositionY[c]));
+    m_AreaCompliance.push_back(compliance);
+    return static_cast<uint32_t>(m_AreaA.size() - 1);
+}
+
+void ParticleSystem::AddCollider(const Circle& circle)
+{
+    m_CircleColliders.Add(circle);
+}
+
+void ParticleSystem::AddCollider(const AABB& box)
+{
+    m_BoxColliders.push_back(box);
+}
+
+void ParticleSystem::ClearColliders()
+{
+    m_CircleColliders.Clear();
+    m_BoxColliders.clear();
+}
+
+glm::vec2 ParticleSystem::GetPosition(uint32_t index) const
+{
+    return {m_PositionX[index], m_PositionY[index]};
+}
+
+void ParticleSystem::SetPosition(uint32_t index, const glm::vec2& position)
+{
+    m_PositionX[index] = position.x;
+    m_PositionY[index] = position.y;
+}
+
+glm::vec2 ParticleSystem::GetVelocity(uint32_t index) const
+{
+    return {m_VelocityX[index], m_VelocityY[index]};
+}
+
+void ParticleSystem::SetVelocity(uint32_t index, const glm::vec2& velocity)
+{
+    if (m_InvMass[index] == 0.0f)
+        return;
+    m_VelocityX[index] = velocity.x;
+    m_VelocityY[index] = velocity.y;
+}
+
+ParticleArrays ParticleSystem::GetArrays()
+{
+    return {m_PositionX.data(), m_PositionY.data(), m_PreviousX.data(),
+            m_PreviousY.data(), m_VelocityX.data(), m_VelocityY.data(),
+            m_InvMass.data(),   m_Radius.data()};
+}
+
+/**
+ * @brief 한 스텝을 substep 개로 나눠 진행합니다.
+ *
+ * 입자 후보 쌍은 스텝 시작에 한 번만 찾고 substep 마다 실제 거리로
+ * 다시 판정합니다. 정적 도형 충돌을 마지막에 투영해 제약에 끌려
+ * 도형 안으로 들어간 입자도 밖으로 나오게 합니다.
+ */
+void ParticleSystem::Step(float dt)
+{
+    if (dt <= 0.0f || m_Substeps == 0 || GetParticleCount() == 0)
+        return;
+
+    CPE2D_PROFILE_SCOPE("ParticleSystem::Step");
+
+    if (m_ParticleCollision)
+        FindParticlePairs(dt);
+    else
+        m_ParticlePairs.clear();
+
+    const float h = dt / float(m_Substeps);
+    for (uint32_t substep = 0; substep < m_Substeps; ++substep)
+    {
+        Integrate(h);
+        SolveDistanceConstraints(h);
+        SolveAreaConstraints(h);
+        SolveParticleContacts();
+        SolveColliders();
+        UpdateVelocities(h);
+    }
+}
+
+/**
+ * @brief 반지름을 이번 스텝의 이동량만큼 늘린 원으로 후보 쌍을 찾습니다.
+ *
+ * 격자 셀 크기는 가장 큰 원의 지름을 따르므로, 튕겨 나간 입자 하나가 셀을
+ * 키워 전체가 느려지지 않도록 늘리는 양은 반지름까지로 제한합니다.
+ * (그보다 빠른 입자끼리는 서로 통과할 수 있습니다.)
+ */
+void ParticleSystem::FindParticlePairs(float dt)
+{
+    const uint32_t count = GetParticleCount();
+    const float gravity = std::sqrt(glm::dot(m_Gravity, m_Gravity)) * dt;
+
+    m_SweptParticles.Clear();
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        const float vx = m_VelocityX[i];
+        const float vy = m_VelocityY[i];
+        const float travel = (std::sqrt(vx * vx + vy * vy) + gravity) * dt;
+        const float radius = m_Radius[i];
+        m_SweptParticles.Add(Circle(radius + std::min(travel, radius),
+                                    {m_PositionX[i], m_PositionY[i]}));
+    }
+    m_Grid.FindPairs(m_SweptParticles, m_ParticlePairs);
+}
+
+void ParticleSystem::Integrate(float h)
+{
+    const ParticleArrays p = GetArrays();
+    const uint32_t count = GetParticleCount();
+    const float dvx = m_Gravity.x * h;
+    const float dvy = m_Gravity.y * h;
+
+    uint32_t first = 0;
+#if defined(CPE2D_SIMD_AVX2)
+    if (m_SimdLevel == SimdLevel::AVX2)
+        first = IntegrateWide<Float8>(p, count, dvx, dvy, h);
+#endif
+#if defined(CPE2D_SIMD_SSE2)
+    if (m_SimdLevel == SimdLevel::SSE2)
+        first = IntegrateWide<Float4>(p, count, dvx, dvy, h);
+#endif
+    for (uint32_t i = first; i < count; ++i)
+        IntegrateParticle(p, i, dvx, dvy, h);
+}
+
+/**
+ * @brief 거리 제약을 Gauss-Seidel 로 한 번 투영합니다.
+ *
+ * substep 마다 λ 를 0 에서 시작하므로 Δλ = -C / (w + α / h²) 입니다.
+ */
+void ParticleSystem::SolveDistanceConstraints(float h)
+{
+    const float invHSq = 1.0f / (h * h);
+    const uint32_t count = static_cast<uint32_t>(m_DistanceA.size());
+    for (uint32_t k = 0; k < count; ++k)
+    {
+        const uint32_t a = m_DistanceA[k];
+        const uint32_t b = m_DistanceB[k];
+        const float wa = m_InvMass[a];
+        const float wb = m_InvMass[b];
+        const float w = wa + wb;
+        if (w == 0.0f)
+            continue;
+
+        const float dx = m_PositionX[b] - m_PositionX[a];
+        const float dy = m_PositionY[b] - m_PositionY[a];
+        const float length = std::sqrt(dx * dx + dy * dy);
+        if (length == 0.0f)
+            continue;
+
+        const float alpha = m_DistanceCompliance[k] * invHSq;
+        const float lambda = -(length - m_DistanceRest[k]) / (w + alpha);
+        const float nx = dx / length * lambda;
+        const float ny = dy / length * lambda;
+        m_PositionX[a] -= nx * wa;
+        m_PositionY[a] -= ny * wa;
+        m_PositionX[b] += nx * wb;
+        m_PositionY[b] += ny * wb;
+    }
+}
+
+/**
+ * @brief 삼각형 넓이 제약을 한 번 투영합니다.
+ *
+ * C = 넓이 - 초기 넓이, 꼭짓점 i 의 기울기는 맞은편 변을 90 도 돌린
+ * 벡터의 절반입니다.
+ */
+void ParticleSystem::SolveAreaConstraints(float h)
+{
+    const float invHSq = 1.0f / (h * h);
+    const uint32_t count = static_cast<uint32_t>(m_AreaA.size());
+    for (uint32_t k = 0; k < count; ++k)
+    {
+        const uint32_t a = m_AreaA[k];
+        const uint32_t b = m_AreaB[k];
+        const uint32_t c = m_AreaC[k];
+        const float wa = m_InvMass[a];
+        const float wb = m_InvMass[b];
+        const float wc = m_InvMass[c];
+
+        const float ax = m_PositionX[a];
+        const float ay = m_PositionY[a];
+        const float bx = m_PositionX[b];
+        const float by = m_PositionY[b];
+        const float cx = m_PositionX[c];
+        const float cy = m_PositionY[c];
+
+        const glm::vec2 ga(0.5f * (by - cy), 0.5f * (cx - bx));
+        const glm::vec2 gb(0.5f * (cy - ay), 0.5f * (ax - cx));
+        const glm::vec2 gc(0.5f * (ay - by), 0.5f * (bx - ax));
+        const float alpha = m_AreaCompliance[k] * invHSq;
+        const float denominator = wa * glm::dot(ga, ga) +
+                                  wb * glm::dot(gb, gb) +
+                                  wc * glm::dot(gc, gc) + alpha;
+        if (denominator == 0.0f)
+            continue;
+
+        const float C = TriangleArea(ax, ay, bx, by, cx, cy) - m_AreaRest[k];
+        const float lambda = -C / denominator;
+        m_PositionX[a] += ga.x * (wa * lambda);
+        m_PositionY[a] += ga.y * (wa * lambda);
+        m_PositionX[b] += gb.x * (wb * lambda);
+        m_PositionY[b] += gb.y * (wb * lambda);
+        m_PositionX[c] += gc.x * (wc * lambda);
+        m_PositionY[c] += gc.y * (wc * lambda);
+    }
+}
+
+/**
+ * @brief 겹친 입자 쌍을 역질량 비율로 떨어뜨립니다.
+ */
+void ParticleSystem::SolveParticleContacts()
+{
+    for (const OverlapPair& pair : m_ParticlePairs)
+    {
+        const uint32_t a = pair.a;
+        const uint32_t b = pair.b;
+        const float wa = m_InvMass[a];
+        const float wb = m_InvMass[b];
+        const float w = wa + wb;
+        if (w == 0.0f)
+            continue;
+
+        const float dx = m_PositionX[b] - m_PositionX[a];
+        const float dy = m_PositionY[b] - m_PositionY[a];
+        const float r = m_Radius[a] + m_Radius[b];
+        const float distSq = dx * dx + dy * dy;
+        if ((distSq < r * r) == false || distSq == 0.0f)
+            continue;
+
+        const float dist = std::sqrt(distSq);
+        const float s = (r - dist) / (dist * w);
+        m_PositionX[a] -= dx * (s * wa);
+        m_PositionY[a] -= dy * (s * wa);
+        m_PositionX[b] += dx * (s * wb);
+        m_PositionY[b] += dy * (s * wb);
+    }
+}
+
+/**
+ * @brief 정적 도형마다 모든 입자를 밀어냅니다. (도형 순서 → 입자 순서)
+ */
+void ParticleSystem::SolveColliders()
+{
+    const ParticleArrays p = GetArrays();
+    const uint32_t count = GetParticleCount();
+
+    for (uint32_t k = 0; k < m_CircleColliders.Size(); ++k)
+    {
+        const float cx = m_CircleColliders.X()[k];
+        const float cy = m_CircleColliders.Y()[k];
+        const float cr = m_CircleColliders.Radius()[k];
+
+        uint32_t first = 0;
+#if defined(CPE2D_SIMD_AVX2)
+        if (m_SimdLevel == SimdLevel::AVX2)
+            first = CollideCircleWide<Float8>(p, count, cx, cy, cr, m_Friction);
+#endif
+#if defined(CPE2D_SIMD_SSE2)
+        if (m_SimdLevel == SimdLevel::SSE2)
+            first = CollideCircleWide<Float4>(p, count, cx, cy, cr, m_Friction);
+#endif
+        for (uint32_t i = first; i < count; ++i)
+            CollideCircle(p, i, cx, cy, cr, m_Friction);
+    }
+
+    for (const AABB& box : m_BoxColliders)
+    {
+        uint32_t first = 0;
+#if defined(CPE2D_SIMD_AVX2)
+        if (m_SimdLevel == SimdLevel::AVX2)
+            first = CollideBoxWide<Float8>(p, count, box, m_Friction);
+#endif
+#if defined(CPE2D_SIMD_SSE2)
+        if (m_SimdLevel == SimdLevel::SSE2)
+            first = CollideBoxWide<Float4>(p, count, box, m_Friction);
+#endif
+        for (uint32_t i = first; i < count; ++i)
+            CollideBox(p, i, box, m_Friction);
+    }
+}
+
+void ParticleSystem::UpdateVelocities(float h)
+{
+    const ParticleArrays p = GetArrays();
+    const uint32_t count = GetParticleCount();
+    const float invH = 1.0f / h;
+
+    uint32_t first = 0;
+#if defined(CPE2D_SIMD_AVX2)
+    if (m_SimdLevel == SimdLevel::AVX2)
+        first = UpdateVelocitiesWide<Float8>(p, count, invH);
+#endif
+#if defined(CPE2D_SIMD_SSE2)
+    if (m_SimdLevel == SimdLevel::SSE2)
+        first = UpdateVelocitiesWide<Float4>(p, count, invH);
+#endif
+    for (uint32_t i = first; i < count; ++i)
+        UpdateVelocity(p, i, invH);
+}
+
+} // namespace CitadelPhysicsEngine2D
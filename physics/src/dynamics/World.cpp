@@ -0,0 +1,1282 @@
+#include <CitadelPhysicsEngine2D/dynamics/World.h>
+
+#include <CitadelPhysicsEngine2D/collision/GJK.h>
+#include <CitadelPhysicsEngine2D/collision/Narrowphase.h>
+#include <CitadelPhysicsEngine2D/collision/SAT.h>
+#include <CitadelPhysicsEngine2D/memory/SnapshotBuffer.h>
+#include <CitadelPhysicsEngine2D/profiling/Profiler.h>
+#include <CitadelPhysicsEngine2D/shapes/AABBSoA.h>
+#include <CitadelPhysicsEngine2D/shapes/Circle.h>
+#include <CitadelPhysicsEngine2D/shapes/CircleSoA.h>
+#include <CitadelPhysicsEngine2D/shapes/OBB.h>
+#include <CitadelPhysicsEngine2D/shapes/Polygon.h>
+#include <CitadelPhysicsEngine2D/threading/JobSystem.h>
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <new>
+
+namespace CitadelPhysicsEngine2D
+{
+
+namespace
+{
+
+// 이 속도 아래로 TimeToSleep 초 이상 머문 island 는 잠듭니다.
+constexpr float LinearSleepTolerance = 0.01f;
+constexpr float AngularSleepTolerance = 2.0f / 180.0f * float(M_PI);
+constexpr float TimeToSleep = 0.5f;
+
+// 스냅샷 형식이 바뀌면 올립니다.
+constexpr uint32_t SnapshotVersion = 7;
+
+// 스텝마다 접촉 캐시를 검사하는 최소 칸 수 (용량 / 16 과 큰 쪽)
+constexpr uint32_t MinCacheSweepSlots = 64;
+
+// narrowphase 작업 하나가 맡는 최대 쌍 수
+constexpr uint32_t NarrowphaseGrain = 128;
+
+// broadphase 질의 작업 하나가 맡는 body 수
+constexpr uint32_t PairQueryGrain = 64;
+
+float CrossVV(const glm::vec2& a, const glm::vec2& b)
+{
+    return a.x * b.y - a.y * b.x;
+}
+
+// 32 비트 단위 FNV-1a
+constexpr uint64_t HashOffset = 0xcbf29ce484222325ull;
+constexpr uint64_t HashPrime = 0x100000001b3ull;
+
+uint64_t HashWord(uint64_t hash, uint32_t word)
+{
+    return (hash ^ word) * HashPrime;
+}
+
+// -0.0f 와 0.0f, NaN 비트까지 구분하도록 값이 아닌 비트 패턴을 섞습니다.
+uint64_t HashFloat(uint64_t hash, float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return HashWord(hash, bits);
+}
+
+// union-find 루트 (경로 절반 압축)
+uint32_t FindIslandRoot(uint32_t* parent, uint32_t index)
+{
+    while (parent[index] != index)
+    {
+        parent[index] = parent[parent[index]];
+        index = parent[index];
+    }
+    return index;
+}
+
+// 캐시의 A / B 를 밀집 순서 쌍의 A / B 로 (또는 반대로) 바꿉니다.
+void FlipFeatureCache(CachedContact& cache)
+{
+    cache.sat.onB ^= 1;
+    std::swap(cache.simplex.indexA, cache.simplex.indexB);
+}
+
+// 호출 스레드가 지금 Step 중인 World
+// FrameArena 의 0 번 하위 arena 는 이 스레드 몫입니다. (FindPairs)
+thread_local const World* t_SteppingWorld = nullptr;
+
+using Clock = std::chrono::steady_clock;
+
+// since 부터 지금까지의 밀리초를 반환하고 since 를 지금으로 옮깁니다.
+float Lap(Clock::time_point& since)
+{
+    const Clock::time_point now = Clock::now();
+    const float ms =
+        std::chrono::duration<float, std::milli>(now - since).count();
+    since = now;
+    return ms;
+}
+
+} // namespace
+
+World::World(const glm::vec2& gravity) : m_Gravity(gravity) {}
+
+void World::SetJobSystem(JobSystem* jobs)
+{
+    m_JobSystem = jobs;
+    m_Solver.SetJobSystem(jobs);
+    // 작업 스레드마다 하위 arena 하나
+    m_FrameArena.SetThreadCount(jobs != nullptr ? jobs->GetThreadCount() : 1);
+}
+
+template <typename Self, typename Function>
+void World::ForEachBodyArray(Self& self, Function&& function)
+{
+    function(self.m_PositionX);
+    function(self.m_PositionY);
+    function(self.m_Angle);
+    function(self.m_VelocityX);
+    function(self.m_VelocityY);
+    function(self.m_AngularVelocity);
+    function(self.m_InvMass);
+    function(self.m_InvInertia);
+    function(self.m_GravityScale);
+    function(self.m_Shape);
+    function(self.m_Radius);
+    function(self.m_HalfExtentX);
+    function(self.m_HalfExtentY);
+    function(self.m_Friction);
+    function(self.m_Restitution);
+    function(self.m_Bullet);
+    function(self.m_Polygon);
+    function(self.m_ProxyId);
+    function(self.m_Awake);
+    function(self.m_WokenSlot);
+    function(self.m_SleepTime);
+    function(self.m_IslandNext);
+    function(self.m_IslandPrev);
+    function(self.m_PairsQueried);
+}
+
+/**
+ * @brief body 를 만들고 핸들을 반환합니다.
+ *
+ * 새 body 는 모든 SoA 배열 끝(밀집 인덱스 GetBodyCount() - 1)에 붙고, 동적
+ * body 는 다음 Step 시작에 깨어 있는 앞쪽으로 옮겨집니다.
+ */
+BodyHandle World::CreateBody(const BodyDef& def)
+{
+    const BodyHandle handle = m_Bodies.Create();
+    const uint32_t index = m_Bodies.GetSize() - 1;
+    ForEachBodyArray(*this, [=](auto& values) { values.resize(index + 1); });
+
+    m_PositionX[index] = def.position.x;
+    m_PositionY[index] = def.position.y;
+    m_Angle[index] = def.angle;
+    m_Shape[index] = def.shape;
+    m_Radius[index] = def.radius;
+    m_HalfExtentX[index] = def.halfExtents.x;
+    m_HalfExtentY[index] = def.halfExtents.y;
+    m_Friction[index] = def.friction;
+    m_Restitution[index] = def.restitution;
+    m_Bullet[index] = def.bullet ? 1 : 0;
+    m_Polygon[index] = def.shape == ShapeType::Box
+                           ? Polygon::MakeBox(def.halfExtents)
+                           : Polygon();
+
+    float mass = 0.0f;
+    float inertia = 0.0f;
+    if (def.shape == ShapeType::Circle)
+    {
+        float r = def.radius;
+        mass = def.density * float(M_PI) * r * r;
+        inertia = 0.5f * mass * r * r;
+    }
+    else
+    {
+        glm::vec2 h = def.halfExtents;
+        mass = def.density * 4.0f * h.x * h.y;
+        inertia = mass * (h.x * h.x + h.y * h.y) / 3.0f;
+    }
+
+    const bool dynamic = def.type == BodyType::Dynamic && mass > 0.0f;
+    m_InvMass[index] = dynamic ? 1.0f / mass : 0.0f;
+    m_InvInertia[index] = dynamic && inertia > 0.0f ? 1.0f / inertia : 0.0f;
+    m_GravityScale[index] = dynamic ? 1.0f : 0.0f;
+    m_VelocityX[index] = dynamic ? def.linearVelocity.x : 0.0f;
+    m_VelocityY[index] = dynamic ? def.linearVelocity.y : 0.0f;
+    m_AngularVelocity[index] = dynamic ? def.angularVelocity : 0.0f;
+
+    m_Awake[index] = dynamic ? 1 : 0;
+    m_SleepTime[index] = 0.0f;
+    m_IslandNext[index] = index;
+    m_IslandPrev[index] = index;
+    m_PairsQueried[index] = 0;
+    m_WokenSlot[index] = BodyHandle::InvalidIndex;
+    if (dynamic)
+    {
+        AddWoken(index);
+        ++m_AwakeBodyCount;
+    }
+
+    m_ProxyId[index] = m_Tree.CreateProxy(ComputeAABB(index), index);
+    return handle;
+}
+
+/**
+ * @brief body 를 제거합니다. 핸들의 세대가 올라가 기존 핸들은 무효가 됩니다.
+ *
+ * 깨어 있는 앞쪽에 있으면 먼저 앞쪽 끝으로 옮긴 뒤, 마지막 body 를 빈자리로
+ * 옮겨(swap-and-pop) 배열을 빈틈 없이 유지합니다.
+ */
+void World::DestroyBody(BodyHandle handle)
+{
+    uint32_t index = m_Bodies.GetDenseIndex(handle);
+
+    // 같은 island 의 나머지 body 는 받치던 body 가 사라지므로 깨웁니다.
+    if (m_InvMass[index] > 0.0f)
+        WakeIsland(index);
+
+    if (index < m_AwakeCount)
+    {
+        SwapBodies(index, --m_AwakeCount);
+        index = m_AwakeCount;
+    }
+    else if (m_WokenSlot[index] != BodyHandle::InvalidIndex)
+    {
+        RemoveWoken(index);
+    }
+    if (m_Awake[index] != 0)
+        --m_AwakeBodyCount;
+    m_Tree.DestroyProxy(m_ProxyId[index]);
+
+    // 마지막 body 는 앞쪽 밖에 있으므로 옮겨도 앞쪽은 그대로
+    const uint32_t last = m_Bodies.GetSize() - 1;
+    m_Bodies.Destroy(handle);
+    if (index != last)
+        MoveBody(last, index);
+    ForEachBodyArray(*this, [=](auto& values) { values.resize(last); });
+}
+
+/**
+ * @brief from 의 body 를 to 로 옮기고 from 을 가리키던 참조를 고칩니다.
+ *
+ * 트리 프록시, 깨어난 목록 위치와 island 리스트의 이웃만 고치므로 O(1)
+ * 입니다.
+ */
+void World::MoveBody(uint32_t from, uint32_t to)
+{
+    ForEachBodyArray(*this, [=](auto& values) { values[to] = values[from]; });
+    m_Tree.SetUserData(m_ProxyId[to], to);
+    if (m_WokenSlot[to] != BodyHandle::InvalidIndex)
+        m_WokenBodies[m_WokenSlot[to]] = to;
+
+    if (m_IslandNext[to] == from)
+    {
+        m_IslandNext[to] = to;
+        m_IslandPrev[to] = to;
+        return;
+    }
+    m_IslandPrev[m_IslandNext[to]] = to;
+    m_IslandNext[m_IslandPrev[to]] = to;
+}
+
+/**
+ * @brief 두 body 의 밀집 인덱스를 맞바꿉니다.
+ *
+ * island 리스트는 두 칸이 가리키던 번호를 먼저 바꾼 뒤 이웃이 새 칸을
+ * 가리키게 하므로, 두 body 가 같은 island 에 있거나 이웃이어도 맞습니다.
+ */
+void World::SwapBodies(uint32_t i, uint32_t j)
+{
+    if (i == j)
+        return;
+
+    m_Bodies.Swap(i, j);
+    ForEachBodyArray(*this,
+                     [=](auto& values) { std::swap(values[i], values[j]); });
+    m_Tree.SetUserData(m_ProxyId[i], i);
+    m_Tree.SetUserData(m_ProxyId[j], j);
+
+    auto relabel = [=](uint32_t k) { return k == i ? j : (k == j ? i : k); };
+    for (const uint32_t k : {i, j})
+    {
+        m_IslandNext[k] = relabel(m_IslandNext[k]);
+        m_IslandPrev[k] = relabel(m_IslandPrev[k]);
+    }
+    for (const uint32_t k : {i, j})
+    {
+        m_IslandNext[m_IslandPrev[k]] = k;
+        m_IslandPrev[m_IslandNext[k]] = k;
+        if (m_WokenSlot[k] != BodyHandle::InvalidIndex)
+            m_WokenBodies[m_WokenSlot[k]] = k;
+    }
+}
+
+/**
+ * @brief 깨어 있는 동적 body 를 밀집 배열 앞쪽 [0, m_AwakeCount) 로 모읍니다.
+ *
+ * 지난 UpdateSleep 에서 잠든 body 는 앞쪽 끝의 body 와 맞바꿔 밖으로 빼고,
+ * 그 뒤에 깨어난 body 는 인덱스 순서대로 앞쪽 바로 뒤 칸과 맞바꿉니다.
+ * 잠들고 깨는 body 수만큼만 옮기며, 순서가 입력에만 의존하므로 결과는
+ * 결정적입니다.
+ */
+void World::CompactAwakeBodies()
+{
+    uint32_t i = 0;
+    while (i < m_AwakeCount)
+    {
+        if (m_Awake[i] != 0)
+            ++i;
+        else
+            SwapBodies(i, --m_AwakeCount);
+    }
+
+    // 오름차순으로 옮기면 아직 옮기지 않은 깨어난 body 는 앞쪽 끝보다 뒤에
+    // 있으므로 맞바꿀 상대가 되지 않습니다.
+    std::sort(m_WokenBodies.begin(), m_WokenBodies.end());
+    for (const uint32_t woken : m_WokenBodies)
+        m_WokenSlot[woken] = BodyHandle::InvalidIndex;
+    for (const uint32_t woken : m_WokenBodies)
+        SwapBodies(woken, m_AwakeCount++);
+    m_WokenBodies.clear();
+}
+
+bool World::IsValid(BodyHandle handle) const
+{
+    return m_Bodies.IsValid(handle);
+}
+
+glm::vec2 World::GetPosition(BodyHandle handle) const
+{
+    const uint32_t index = m_Bodies.GetDenseIndex(handle);
+    return {m_PositionX[index], m_PositionY[index]};
+}
+
+float World::GetAngle(BodyHandle handle) const
+{
+    return m_Angle[m_Bodies.GetDenseIndex(handle)];
+}
+
+Transform2D World::GetTransform(BodyHandle handle) const
+{
+    return Transform2D(GetPosition(handle), GetAngle(handle));
+}
+
+void World::SetTransform(BodyHandle handle, const glm::vec2& position,
+                         float angle)
+{
+    const uint32_t index = m_Bodies.GetDenseIndex(handle);
+    m_PositionX[index] = position.x;
+    m_PositionY[index] = position.y;
+    m_Angle[index] = angle;
+    m_Tree.MoveProxy(m_ProxyId[index], ComputeAABB(index));
+    WakeIsland(index);
+}
+
+glm::vec2 World::GetLinearVelocity(BodyHandle handle) const
+{
+    const uint32_t index = m_Bodies.GetDenseIndex(handle);
+    return {m_VelocityX[index], m_VelocityY[index]};
+}
+
+void World::SetLinearVelocity(BodyHandle handle, const glm::vec2& velocity)
+{
+    const uint32_t index = m_Bodies.GetDenseIndex(handle);
+    if (m_InvMass[index] == 0.0f)
+        return;
+    m_VelocityX[index] = velocity.x;
+    m_VelocityY[index] = velocity.y;
+    WakeIsland(index);
+}
+
+float World::GetAngularVelocity(BodyHandle handle) const
+{
+    return m_AngularVelocity[m_Bodies.GetDenseIndex(handle)];
+}
+
+void World::SetAngularVelocity(BodyHandle handle, float velocity)
+{
+    const uint32_t index = m_Bodies.GetDenseIndex(handle);
+    if (m_InvInertia[index] == 0.0f)
+        return;
+    m_AngularVelocity[index] = velocity;
+    WakeIsland(index);
+}
+
+/**
+ * @brief 월드 좌표 point 에 충격량을 가합니다. (정적 body 는 무시)
+ */
+void World::ApplyLinearImpulse(BodyHandle handle, const glm::vec2& impulse,
+                               const glm::vec2& point)
+{
+    const uint32_t i = m_Bodies.GetDenseIndex(handle);
+    if (m_InvMass[i] == 0.0f)
+        return;
+    WakeIsland(i);
+    glm::vec2 r = point - glm::vec2(m_PositionX[i], m_PositionY[i]);
+    m_VelocityX[i] += m_InvMass[i] * impulse.x;
+    m_VelocityY[i] += m_InvMass[i] * impulse.y;
+    m_AngularVelocity[i] += m_InvInertia[i] * CrossVV(r, impulse);
+}
+
+bool World::IsAwake(BodyHandle handle) const
+{
+    return m_Awake[m_Bodies.GetDenseIndex(handle)] != 0;
+}
+
+void World::WakeBody(BodyHandle handle)
+{
+    WakeIsland(m_Bodies.GetDenseIndex(handle));
+}
+
+void World::SetSleepingEnabled(bool enabled)
+{
+    m_SleepingEnabled = enabled;
+    if (enabled)
+        return;
+
+    const uint32_t n = m_Bodies.GetSize();
+    for (uint32_t i = 0; i < n; ++i)
+        WakeIsland(i);
+}
+
+/**
+ * @brief 잠든 body 가 속한 island 전체를 깨웁니다.
+ *
+ * 깨어 있거나 정적인 body 면 아무것도 하지 않습니다. body 는 옮기지 않고
+ * 앞쪽 밖에 있는 body 만 m_WokenBodies 에 붙이므로, Collide 도중이면 같은
+ * 스텝에 쌍을 찾고 다음 Step 시작에 앞쪽으로 옮겨집니다.
+ */
+void World::WakeIsland(uint32_t index)
+{
+    if (m_Awake[index] != 0 || m_InvMass[index] == 0.0f)
+        return;
+
+    uint32_t i = index;
+    do
+    {
+        const uint32_t next = m_IslandNext[i];
+        m_Awake[i] = 1;
+        m_SleepTime[i] = 0.0f;
+        m_IslandNext[i] = i;
+        m_IslandPrev[i] = i;
+        // 이번 스텝에 잠들어 아직 앞쪽에 남아 있던 body 는 그대로 둠
+        if (i >= m_AwakeCount)
+            AddWoken(i);
+        ++m_AwakeBodyCount;
+        i = next;
+    } while (i != index);
+}
+
+/**
+ * @brief 앞쪽 밖의 깨어난 body 를 m_WokenBodies 끝에 붙입니다.
+ */
+void World::AddWoken(uint32_t index)
+{
+    m_WokenSlot[index] = static_cast<uint32_t>(m_WokenBodies.size());
+    m_WokenBodies.push_back(index);
+}
+
+/**
+ * @brief m_WokenBodies 에서 body 를 마지막 항목과 맞바꿔 O(1) 로 뺍니다.
+ */
+void World::RemoveWoken(uint32_t index)
+{
+    const uint32_t slot = m_WokenSlot[index];
+    const uint32_t last = m_WokenBodies.back();
+    m_WokenBodies[slot] = last;
+    m_WokenSlot[last] = slot;
+    m_WokenBodies.pop_back();
+    m_WokenSlot[index] = BodyHandle::InvalidIndex;
+}
+
+AABB World::ComputeAABB(uint32_t index) const
+{
+    glm::vec2 position(m_PositionX[index], m_PositionY[index]);
+    if (m_Shape[index] == ShapeType::Circle)
+        return Circle(m_Radius[index], position).GetAABB();
+
+    glm::vec2 h(m_HalfExtentX[index], m_HalfExtentY[index]);
+    return OBB(position, h, m_Angle[index]).GetAABB();
+}
+
+/**
+ * @brief 한 스텝을 진행합니다.
+ *
+ * 속도 적분 → broadphase → narrowphase → 접촉 캐시 / 이벤트 → 접촉 해결
+ * → CCD → 위치 적분 → 위치 보정 → 수면 판정 → 캐시 정리
+ * 단계별 소요 시간은 GetProfile 로 확인합니다.
+ */
+void World::Step(float dt)
+{
+    if (dt <= 0.0f)
+        return;
+
+    CPE2D_PROFILE_SCOPE("World::Step");
+    const Clock::time_point start = Clock::now();
+    Clock::time_point stage = start;
+    const World* const outerWorld = t_SteppingWorld;
+    t_SteppingWorld = this;
+
+    ++m_StepIndex;
+    CompactAwakeBodies();
+    IntegrateVelocities(dt);
+    m_Profile.integrateVelocities = Lap(stage);
+    UpdateBroadphase(dt);
+    m_Profile.broadphase = Lap(stage);
+    Collide();
+    m_Profile.collide = Lap(stage);
+    UpdateContactCache();
+    SolveContacts();
+    m_Profile.solveVelocities = Lap(stage);
+    SolveTimeOfImpacts(dt);
+    m_Profile.continuous = Lap(stage);
+    IntegratePositions(dt);
+    m_Profile.integratePositions = Lap(stage);
+    SolvePositions();
+    m_Profile.solvePositions = Lap(stage);
+    UpdateSleep(dt);
+    SweepContactCache();
+    m_Profile.sleep = Lap(stage);
+    m_FrameArena.Reset();
+
+    t_SteppingWorld = outerWorld;
+
+    if (m_StateHashEnabled)
+        m_StateHash = ComputeStateHash();
+
+    m_Profile.step =
+        std::chrono::duration<float, std::milli>(Clock::now() - start)
+            .count();
+}
+
+/**
+ * @brief 시뮬레이션 상태의 64 비트 해시를 계산합니다.
+ *
+ * 밀집 순서대로 body 의 id / 세대 / 수면 플래그와 위치, 각도, 속도, 수면
+ * 타이머 비트를 섞습니다. 형상과 재질은 스텝 중에 바뀌지 않으므로
+ * 넣지 않고, 마지막에 비트를 한 번 더 섞어 하위 비트도 고르게 만듭니다.
+ */
+uint64_t World::ComputeStateHash() const
+{
+    const uint32_t n = m_Bodies.GetSize();
+    uint64_t hash = HashWord(HashOffset, n);
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        const BodyHandle handle = m_Bodies.GetHandle(i);
+        hash = HashWord(hash, handle.index);
+        hash = HashWord(hash, handle.generation);
+        hash = HashWord(hash, m_Awake[i]);
+        hash = HashFloat(hash, m_PositionX[i]);
+        hash = HashFloat(hash, m_PositionY[i]);
+        hash = HashFloat(hash, m_Angle[i]);
+        hash = HashFloat(hash, m_VelocityX[i]);
+        hash = HashFloat(hash, m_VelocityY[i]);
+        hash = HashFloat(hash, m_AngularVelocity[i]);
+        hash = HashFloat(hash, m_SleepTime[i]);
+    }
+
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+/**
+ * @brief 전체 시뮬레이션 상태를 스냅샷 버퍼에 기록합니다.
+ *
+ * body 배열은 각각 한 번의 memcpy 로 복사되고, 핸들 풀, 트리, 접촉 캐시도
+ * 연속 배열이라 body 수와 관계없이 배열 개수만큼의 복사로 끝납니다.
+ */
+void World::SaveSnapshot(WorldSnapshot& snapshot) const
+{
+    snapshot.m_Data.clear();
+    SnapshotWriter writer(snapshot.m_Data);
+    writer.Write(SnapshotVersion);
+
+    m_Bodies.SaveState(writer);
+    ForEachBodyArray(*this,
+                     [&](const auto& values) { writer.WriteArray(values); });
+    writer.Write(m_AwakeCount);
+    writer.Write(m_AwakeBodyCount);
+    writer.WriteArray(m_WokenBodies);
+    writer.Write(m_StateHash);
+
+    m_Tree.SaveState(writer);
+    writer.WriteArray(m_Contacts);
+    writer.WriteArray(m_ContactKeys);
+    writer.Write(m_StepIndex);
+    m_ContactCache.SaveState(writer);
+}
+
+/**
+ * @brief SaveSnapshot 으로 저장한 상태로 되돌립니다.
+ *
+ * 트리는 노드 배열째로 복원되므로 다시 만들지 않습니다.
+ */
+void World::RestoreSnapshot(const WorldSnapshot& snapshot)
+{
+    SnapshotReader reader(snapshot.m_Data.data(), snapshot.m_Data.size());
+    uint32_t version = 0;
+    reader.Read(version);
+    assert(version == SnapshotVersion && "unknown snapshot format");
+
+    m_Bodies.RestoreState(reader);
+    ForEachBodyArray(*this, [&](auto& values) { reader.ReadArray(values); });
+    reader.Read(m_AwakeCount);
+    reader.Read(m_AwakeBodyCount);
+    reader.ReadArray(m_WokenBodies);
+    reader.Read(m_StateHash);
+
+    m_Tree.RestoreState(reader);
+    reader.ReadArray(m_Contacts);
+    reader.ReadArray(m_ContactKeys);
+    reader.Read(m_StepIndex);
+    m_ContactCache.RestoreState(reader);
+    assert(reader.IsAtEnd());
+}
+
+/**
+ * @brief 위치 보정 반복. 침투가 허용 범위 안에 들어오면 일찍 끝냅니다.
+ */
+void World::SolvePositions()
+{
+    CPE2D_PROFILE_SCOPE("World::SolvePositions");
+    const SolverBodies bodies = GetSolverBodies();
+    for (uint32_t i = 0; i < m_PositionIterations; ++i)
+    {
+        if (m_Solver.SolvePositions(bodies))
+            break;
+    }
+}
+
+void World::IntegrateVelocities(float dt)
+{
+    CPE2D_PROFILE_SCOPE("World::IntegrateVelocities");
+    const float gx = m_Gravity.x * dt;
+    const float gy = m_Gravity.y * dt;
+    float* vx = m_VelocityX.data();
+    float* vy = m_VelocityY.data();
+    const float* scale = m_GravityScale.data();
+
+    // Step 시작에 모았으므로 깨어 있는 body 는 모두 앞쪽에 있음
+    assert(m_WokenBodies.empty());
+    const uint32_t count = m_AwakeCount;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        vx[i] += gx * scale[i];
+        vy[i] += gy * scale[i];
+    }
+}
+
+/**
+ * @brief 깨어 있는 body 의 프록시를 갱신합니다.
+ *
+ * 예측 변위(v * dt) 방향으로 fat AABB 를 늘려 재삽입 횟수를 줄입니다.
+ */
+void World::UpdateBroadphase(float dt)
+{
+    CPE2D_PROFILE_SCOPE("World::UpdateBroadphase");
+    for (uint32_t i = 0; i < m_AwakeCount; ++i)
+    {
+        glm::vec2 displacement(m_VelocityX[i] * dt, m_VelocityY[i] * dt);
+        m_Tree.MoveProxy(m_ProxyId[i], ComputeAABB(i), displacement);
+    }
+}
+
+/**
+ * @brief 질의 순번 [firstAwake, ...) 의 깨어 있는 body 의 fat AABB 로 트리를
+ *        질의해 body 쌍을 pairs 에 채웁니다.
+ *
+ * 질의 순번은 앞쪽 [0, m_AwakeCount) 의 body 가 먼저이고, 그 뒤로 이번
+ * 스텝에 깨어난 m_WokenBodies 가 이어집니다. 잠든 body 끼리의 쌍은 찾지
+ * 않습니다. 깨어 있는 두 body 의 쌍은 먼저 질의한 쪽(순번이 작은 쪽)
+ * 에서만 기록하므로 한 번씩만 나옵니다. 질의는
+ * PairQueryGrain 개씩 나눠 실행하고 각 조각은 실행한 스레드의 하위 arena
+ * 에 결과를 모은 뒤, 조각 순서대로 이어 붙이므로 결과는 한 스레드로 차례로
+ * 질의한 것과 같습니다.
+ */
+void World::FindPairs(uint32_t firstAwake, AlignedVector<OverlapPair>& pairs)
+{
+    CPE2D_PROFILE_SCOPE("World::FindPairs");
+    const uint32_t awakeCount = m_AwakeCount;
+    const uint32_t count =
+        awakeCount + static_cast<uint32_t>(m_WokenBodies.size());
+    auto queryBody = [&](uint32_t k)
+    { return k < awakeCount ? k : m_WokenBodies[k - awakeCount]; };
+    for (uint32_t k = firstAwake; k < count; ++k)
+        m_PairsQueried[queryBody(k)] = k + 1;
+
+    using PairList = AlignedVector<OverlapPair>;
+    const uint32_t chunkCount =
+        (count - firstAwake + PairQueryGrain - 1) / PairQueryGrain;
+    PairList* lists = m_FrameArena.GetMain().Allocate<PairList>(chunkCount);
+
+    auto query = [&](uint32_t beginChunk, uint32_t endChunk)
+    {
+        // 작업 스레드가 아닌 스레드는 모두 0 번이므로, 0 번 하위 arena 는 이
+        // World 를 Step 중인 스레드만 씁니다. 같은 JobSystem 으로 다른 World
+        // 를 Step 하다가 Wait 중에 이 작업을 집어 든 스레드는 전역 할당자로
+        // 받습니다.
+        const uint32_t thread = m_JobSystem != nullptr
+                                    ? m_JobSystem->GetCurrentThreadIndex()
+                                    : 0;
+        StackArena* local = thread != 0 || t_SteppingWorld == this
+                                ? &m_FrameArena.GetThreadArena(thread)
+                                : nullptr;
+        for (uint32_t c = beginChunk; c < endChunk; ++c)
+        {
+            const AlignedAllocator<OverlapPair> allocator(local);
+            PairList& list = *new (&lists[c]) PairList(allocator);
+            const uint32_t begin = firstAwake + c * PairQueryGrain;
+            const uint32_t end = std::min(begin + PairQueryGrain, count);
+            for (uint32_t k = begin; k < end; ++k)
+            {
+                const uint32_t a = queryBody(k);
+                m_Tree.Query(m_Tree.GetFatAABB(m_ProxyId[a]),
+                             [&](uint32_t proxyId)
+                             {
+                                 uint32_t b = m_Tree.GetUserData(proxyId);
+                                 // a 자신과 먼저 질의한 body 는 건너뜀
+                                 const uint32_t rank = m_PairsQueried[b];
+                                 if (rank != 0 && rank <= k + 1)
+                                     return true;
+                                 list.push_back({std::min(a, b),
+                                                 std::max(a, b)});
+                                 return true;
+                             });
+            }
+        }
+    };
+    if (m_JobSystem != nullptr)
+        m_JobSystem->ParallelFor(chunkCount, 1, query);
+    else
+        query(0, chunkCount);
+
+    size_t total = 0;
+    for (uint32_t c = 0; c < chunkCount; ++c)
+        total += lists[c].size();
+    pairs.clear();
+    pairs.reserve(total);
+    for (uint32_t c = 0; c < chunkCount; ++c)
+    {
+        pairs.insert(pairs.end(), lists[c].begin(), lists[c].end());
+        lists[c].~PairList();
+    }
+}
+
+/**
+ * @brief 깨어 있는 body 가 포함된 쌍의 접촉을 만듭니다.
+ *
+ * 잠든 body 와 실제로 닿으면 그 island 를 깨우고, 깨어난 body 들의 쌍을
+ * 다시 찾아 같은 스텝 안에서 접촉에 포함시킵니다.
+ */
+void World::Collide()
+{
+    CPE2D_PROFILE_SCOPE("World::Collide");
+    m_Contacts.clear();
+
+    StackArena& arena = m_FrameArena.GetMain();
+    AlignedVector<OverlapPair> pairs = MakeArenaVector<OverlapPair>(arena);
+    // 깨어난 body 는 m_WokenBodies 에 붙으므로 질의 순번이 늘어남
+    auto queryCount = [this]()
+    { return m_AwakeCount + static_cast<uint32_t>(m_WokenBodies.size()); };
+    uint32_t firstAwake = 0;
+    while (firstAwake < queryCount())
+    {
+        FindPairs(firstAwake, pairs);
+        firstAwake = queryCount();
+
+        // 쌍마다 자기 칸에만 쓰므로 나눠 실행해도 결과가 같음
+        const uint32_t pairCount = static_cast<uint32_t>(pairs.size());
+        ContactManifold* manifolds = arena.Allocate<ContactManifold>(pairCount);
+        uint8_t* touching = arena.Allocate<uint8_t>(pairCount);
+
+        // 다각형이 낀 쌍은 닿지 않아도 캐시 항목을 두어, 떨어져 있는 동안에도
+        // 다음 스텝이 분리축 / 단체 하나로 끝나게 합니다. 원-원은 캐시할
+        // 특징이 없으므로 넣지 않습니다.
+        for (const OverlapPair& pair : pairs)
+        {
+            if (m_Shape[pair.a] == ShapeType::Circle &&
+                m_Shape[pair.b] == ShapeType::Circle)
+                continue;
+            InsertContactEntry(MakeContactKey(pair.a, pair.b)).lastPairStep =
+                m_StepIndex;
+        }
+
+        // 캐시 항목의 분리축 / 단체를 이어 씀. 이 단계에서는 캐시에 항목을
+        // 넣거나 빼지 않고, 쌍마다 자기 항목만 고치므로 나눠 실행해도
+        // 안전합니다.
+        auto collide = [&](uint32_t begin, uint32_t end)
+        {
+            for (uint32_t i = begin; i < end; ++i)
+            {
+                const OverlapPair& pair = pairs[i];
+                CachedContact* cache =
+                    m_ContactCache.Find(MakeContactKey(pair.a, pair.b));
+                const bool flipped =
+                    cache != nullptr &&
+                    m_Bodies.GetId(pair.a) > m_Bodies.GetId(pair.b);
+                if (flipped)
+                    FlipFeatureCache(*cache);
+                touching[i] =
+                    CollidePair(pair.a, pair.b, manifolds[i], cache) ? 1 : 0;
+                if (flipped)
+                    FlipFeatureCache(*cache);
+            }
+        };
+        if (m_JobSystem != nullptr)
+            m_JobSystem->ParallelFor(pairCount, NarrowphaseGrain, collide);
+        else
+            collide(0, pairCount);
+
+        for (uint32_t i = 0; i < pairCount; ++i)
+        {
+            if (touching[i] == 0)
+                continue;
+
+            const OverlapPair& pair = pairs[i];
+            ContactManifold& manifold = manifolds[i];
+            manifold.a = pair.a;
+            manifold.b = pair.b;
+            m_Contacts.push_back(manifold);
+            WakeIsland(pair.a);
+            WakeIsland(pair.b);
+        }
+    }
+    std::fill(m_PairsQueried.begin(), m_PairsQueried.begin() + m_AwakeCount,
+              0u);
+    for (uint32_t i : m_WokenBodies)
+        m_PairsQueried[i] = 0;
+
+    // 쌍을 찾는 순서는 트리 구조와 깨어난 순서에 따라 다르므로 body 순으로 정렬
+    std::sort(m_Contacts.begin(), m_Contacts.end(),
+              [](const ContactManifold& lhs, const ContactManifold& rhs)
+              { return lhs.a != rhs.a ? lhs.a < rhs.a : lhs.b < rhs.b; });
+}
+
+/**
+ * @brief 형상 조합에 맞는 narrowphase 함수를 호출합니다.
+ *
+ * 원-원은 전용 함수, 상자-상자는 SAT, 원-상자는 GJK/EPA 를 사용합니다.
+ * 상자는 CreateBody 에서 만든 로컬 다각형을 그대로 쓰고, cache 가 있으면
+ * 지난 스텝의 분리축 / 단체에서 시작한 뒤 이번 결과로 고칩니다.
+ */
+bool World::CollidePair(uint32_t a, uint32_t b, ContactManifold& manifold,
+                        CachedContact* cache) const
+{
+    const glm::vec2 pA(m_PositionX[a], m_PositionY[a]);
+    const glm::vec2 pB(m_PositionX[b], m_PositionY[b]);
+
+    const ShapeType shapeA = m_Shape[a];
+    const ShapeType shapeB = m_Shape[b];
+    if (shapeA == ShapeType::Circle && shapeB == ShapeType::Circle)
+    {
+        return CollideCircles(Circle(m_Radius[a], pA), Circle(m_Radius[b], pB),
+                              manifold);
+    }
+
+    const Transform2D xfA(pA, m_Angle[a]);
+    const Transform2D xfB(pB, m_Angle[b]);
+    if (shapeA == ShapeType::Box && shapeB == ShapeType::Box)
+    {
+        return CollidePolygons(m_Polygon[a], xfA, m_Polygon[b], xfB, manifold,
+                               cache != nullptr ? &cache->sat : nullptr);
+    }
+
+    ConvexProxy proxyA =
+        shapeA == ShapeType::Circle
+            ? ConvexProxy::FromCircle(Circle(m_Radius[a], pA))
+            : ConvexProxy::FromPolygon(m_Polygon[a], xfA);
+    ConvexProxy proxyB =
+        shapeB == ShapeType::Circle
+            ? ConvexProxy::FromCircle(Circle(m_Radius[b], pB))
+            : ConvexProxy::FromPolygon(m_Polygon[b], xfB);
+    return GJKCollide(proxyA, proxyB, manifold,
+                      cache != nullptr ? &cache->simplex : nullptr);
+}
+
+SolverBodies World::GetSolverBodies()
+{
+    return {m_VelocityX.data(), m_VelocityY.data(), m_AngularVelocity.data(),
+            m_PositionX.data(), m_PositionY.data(), m_Angle.data(),
+            m_InvMass.data(), m_InvInertia.data(), m_Friction.data(),
+            m_Restitution.data()};
+}
+
+/**
+ * @brief 두 body (밀집 인덱스) 의 접촉 캐시 키
+ *
+ * 밀집 인덱스는 DestroyBody 때 바뀌므로 바뀌지 않는 body id 로 만듭니다.
+ */
+uint64_t World::MakeContactKey(uint32_t a, uint32_t b) const
+{
+    const uint32_t idA = m_Bodies.GetId(a);
+    const uint32_t idB = m_Bodies.GetId(b);
+    return ContactCache::MakeKey(std::min(idA, idB), std::max(idA, idB));
+}
+
+/**
+ * @brief key 의 캐시 항목을 찾거나 만듭니다.
+ *
+ * 새 항목이거나 body id 가 재사용되었으면 지난 접촉 / 특징을 버리고 현재
+ * 세대로 초기화합니다. 반환된 참조는 다음 Insert / Remove 전까지만
+ * 유효합니다.
+ */
+CachedContact& World::InsertContactEntry(uint64_t key)
+{
+    bool inserted = false;
+    CachedContact& entry = m_ContactCache.Insert(key, inserted);
+    const uint32_t generationA =
+        m_Bodies.GetGeneration(ContactCache::KeyA(key));
+    const uint32_t generationB =
+        m_Bodies.GetGeneration(ContactCache::KeyB(key));
+    if (inserted == false && entry.generationA == generationA &&
+        entry.generationB == generationB)
+        return entry;
+
+    entry = CachedContact{};
+    entry.key = key;
+    entry.generationA = generationA;
+    entry.generationB = generationB;
+    return entry;
+}
+
+/**
+ * @brief 이번 접촉을 캐시에 등록하고 접촉 시작 / 끝 이벤트를 만듭니다.
+ *
+ * 닿지 않던 쌍(새 항목, id 재사용, 분리축만 남은 항목)은 새 접촉입니다.
+ * 지난 스텝에 닿았지만 이번에 없는 쌍은, 두 body 가 모두 잠들어(또는 정적)
+ * 있으면 닿은 채로 남깁니다. 아니면 끝 이벤트를 내고, 아직 broadphase
+ * 쌍이면 분리축 / 단체만 남기고 아니면 캐시에서 지웁니다.
+ */
+void World::UpdateContactCache()
+{
+    CPE2D_PROFILE_SCOPE("World::UpdateContactCache");
+    m_BeginEvents.clear();
+    m_EndEvents.clear();
+
+    // 두 배열을 맞바꾸므로 용량이 유지되어 정상 상태에서는 할당이 없습니다.
+    m_PreviousContactKeys.swap(m_ContactKeys);
+    m_ContactKeys.clear();
+    for (const ContactManifold& contact : m_Contacts)
+    {
+        const uint64_t key = MakeContactKey(contact.a, contact.b);
+        m_ContactKeys.push_back(key);
+
+        CachedContact& entry = InsertContactEntry(key);
+        entry.lastStep = m_StepIndex;
+        if (entry.touching != 0)
+            continue;
+
+        entry.touching = 1;
+        entry.pointCount = 0;
+        m_BeginEvents.push_back({ContactCache::KeyA(key),
+                                 ContactCache::KeyB(key)});
+    }
+
+    // 이번 스텝에 닿은 쌍은 위에서 lastStep 이 갱신되었으므로 나머지가 대상
+    for (uint64_t key : m_PreviousContactKeys)
+    {
+        CachedContact* entry = m_ContactCache.Find(key);
+        if (entry != nullptr && entry->lastStep == m_StepIndex)
+            continue;
+
+        const uint32_t a = ContactCache::KeyA(key);
+        const uint32_t b = ContactCache::KeyB(key);
+        if (entry != nullptr)
+        {
+            const uint32_t i = m_Bodies.GetDenseIndex(a, entry->generationA);
+            const uint32_t j = m_Bodies.GetDenseIndex(b, entry->generationB);
+            const bool sleeping = i != BodyHandle::InvalidIndex &&
+                                  j != BodyHandle::InvalidIndex &&
+                                  m_Awake[i] == 0 && m_Awake[j] == 0;
+            if (sleeping)
+                continue;
+            if (entry->lastPairStep == m_StepIndex)
+            {
+                entry->touching = 0;
+                entry->pointCount = 0;
+            }
+            else
+            {
+                m_ContactCache.Remove(key);
+            }
+        }
+        m_EndEvents.push_back({a, b});
+    }
+}
+
+/**
+ * @brief 접촉 제약 배열을 만들고 warm start 후 속도 반복을 수행합니다.
+ */
+void World::SolveContacts()
+{
+    CPE2D_PROFILE_SCOPE("World::SolveContacts");
+    const SolverBodies bodies = GetSolverBodies();
+    m_Solver.Prepare(m_Contacts.data(),
+                     static_cast<uint32_t>(m_Contacts.size()), bodies,
+                     &m_ContactCache, m_ContactKeys.data());
+    m_Solver.WarmStart(bodies);
+    for (uint32_t i = 0; i < m_VelocityIterations; ++i)
+        m_Solver.SolveVelocities(bodies);
+    m_Solver.StoreImpulses();
+
+    // 다음 스텝의 warm start 용으로 접촉점과 누적 충격량을 캐시에 저장
+    const std::vector<ContactConstraint>& constraints =
+        m_Solver.GetConstraints();
+    for (size_t i = 0; i < constraints.size(); ++i)
+    {
+        const ContactConstraint& c = constraints[i];
+        CachedContact* entry = m_ContactCache.Find(m_ContactKeys[i]);
+        assert(entry != nullptr);
+        entry->pointCount = c.pointCount;
+        for (uint32_t k = 0; k < c.pointCount; ++k)
+        {
+            entry->points[k] = c.points[k].point;
+            entry->normalImpulses[k] = c.points[k].normalImpulse;
+            entry->tangentImpulses[k] = c.points[k].tangentImpulse;
+        }
+    }
+}
+
+/**
+ * @brief 접촉 캐시의 일부 칸만 검사해 더 이상 닿지 않는 쌍을 지웁니다.
+ *
+ * 제거된 body, 재사용된 id, 깨어 있는데 이번 스텝에 닿지 않은 쌍, 그리고
+ * 이번 스텝에 broadphase 쌍이 아니었던 분리축 전용 항목이 대상입니다. 끝
+ * 이벤트는 닿아 있던 항목에만 냅니다. 한 스텝에 최대 용량 / 16 칸만 보므로 전체 재구성 비용이
+ * 한 프레임에 몰리지 않습니다.
+ */
+void World::SweepContactCache()
+{
+    CPE2D_PROFILE_SCOPE("World::SweepContactCache");
+    const uint32_t slotCount =
+        std::max(MinCacheSweepSlots, m_ContactCache.GetCapacity() / 16);
+    m_ContactCache.SweepStale(
+        slotCount,
+        [&](const CachedContact& entry)
+        {
+            const uint32_t a = m_Bodies.GetDenseIndex(
+                ContactCache::KeyA(entry.key), entry.generationA);
+            const uint32_t b = m_Bodies.GetDenseIndex(
+                ContactCache::KeyB(entry.key), entry.generationB);
+            if (a == BodyHandle::InvalidIndex || b == BodyHandle::InvalidIndex)
+                return true;
+            if (entry.touching == 0)
+                return entry.lastPairStep != m_StepIndex;
+            if (entry.lastStep == m_StepIndex)
+                return false;
+            return m_Awake[a] != 0 || m_Awake[b] != 0;
+        },
+        [&](const CachedContact& entry)
+        {
+            if (entry.touching != 0)
+                m_EndEvents.push_back({ContactCache::KeyA(entry.key),
+                                       ContactCache::KeyB(entry.key)});
+        });
+}
+
+/**
+ * @brief bullet 이거나 빠르게 움직이는 원이 이번 스텝에 뚫고 지나가지
+ *        않도록 충돌 시점까지 전진시키고 법선 방향 속도를 제거합니다.
+ *
+ * 장애물은 다른 원과 회전하지 않은 정적 상자입니다. 대부분의 스텝에는 검사할
+ * 원이 없으므로, 깨어 있는 body 에서 후보부터 찾고 없으면 장애물 SoA 를
+ * 만들지 않고 돌아갑니다.
+ */
+void World::SolveTimeOfImpacts(float dt)
+{
+    CPE2D_PROFILE_SCOPE("World::SolveTimeOfImpacts");
+    m_TOIEvents.clear();
+
+    // 잠든 body 는 움직이지 않으므로 깨어 있는 body 만 후보가 됨
+    auto isCandidate = [&](uint32_t i)
+    {
+        if (m_Shape[i] != ShapeType::Circle)
+            return false;
+        glm::vec2 d(m_VelocityX[i] * dt, m_VelocityY[i] * dt);
+        return NeedsTimeOfImpact(d, m_Radius[i], m_Bullet[i] != 0,
+                                 m_CCDSettings);
+    };
+    bool anyCandidate = false;
+    for (uint32_t i = 0; i < m_AwakeCount && anyCandidate == false; ++i)
+        anyCandidate = isCandidate(i);
+    for (uint32_t i : m_WokenBodies)
+        anyCandidate = anyCandidate || isCandidate(i);
+    if (anyCandidate == false)
+        return;
+
+    const uint32_t n = m_Bodies.GetSize();
+    StackArena& arena = m_FrameArena.GetMain();
+    CircleSoA circles(&arena);
+    AABBSoA boxes(&arena);
+    circles.Reserve(n);
+    boxes.Reserve(n);
+    uint32_t* circleBody = arena.Allocate<uint32_t>(n);
+    glm::vec2* displacements = arena.Allocate<glm::vec2>(n);
+    uint8_t* bullets = arena.Allocate<uint8_t>(n);
+
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        glm::vec2 position(m_PositionX[i], m_PositionY[i]);
+        if (m_Shape[i] == ShapeType::Circle)
+        {
+            const uint32_t c = circles.Size();
+            circles.Add(Circle(m_Radius[i], position));
+            circleBody[c] = i;
+            displacements[c] = {m_VelocityX[i] * dt, m_VelocityY[i] * dt};
+            // 잠든 bullet 은 후보에서 빼서 위의 후보 검사와 맞춤
+            bullets[c] = m_Bullet[i] != 0 && m_Awake[i] != 0;
+        }
+        else if (m_InvMass[i] == 0.0f && m_Angle[i] == 0.0f)
+        {
+            glm::vec2 h(m_HalfExtentX[i], m_HalfExtentY[i]);
+            boxes.Add(AABB(position - h, position + h));
+        }
+    }
+
+    FindTimeOfImpacts(circles, displacements, bullets, boxes, m_CCDSettings,
+                      m_TOIEvents, &arena);
+
+    for (const TOIEvent& event : m_TOIEvents)
+    {
+        // 시작부터 겹친 경우는 이미 접촉 해결이 처리했습니다.
+        const uint32_t body = circleBody[event.circle];
+        if (event.toi.t <= 0.0f || m_InvMass[body] == 0.0f)
+            continue;
+
+        // 남은 시간은 접선 방향으로만 미끄러짐
+        glm::vec2 v(m_VelocityX[body], m_VelocityY[body]);
+        float vn = glm::dot(v, event.toi.normal);
+        if (vn > 0.0f)
+            v -= vn * event.toi.normal;
+        m_VelocityX[body] = v.x;
+        m_VelocityY[body] = v.y;
+
+        // 충돌 시점까지 전진한 뒤, IntegratePositions 가 더할 v * dt 중
+        // 이미 지난 t * dt 만큼을 미리 빼 두어 남은 (1 - t) * dt 만 움직이게
+        // 합니다. (위치 적분 루프는 모든 깨어 있는 body 를 그대로 돌림)
+        const glm::vec2& d = displacements[event.circle];
+        const float elapsed = event.toi.t * dt;
+        m_PositionX[body] += event.toi.t * d.x - elapsed * v.x;
+        m_PositionY[body] += event.toi.t * d.y - elapsed * v.y;
+    }
+}
+
+void World::IntegratePositions(float dt)
+{
+    CPE2D_PROFILE_SCOPE("World::IntegratePositions");
+    float* px = m_PositionX.data();
+    float* py = m_PositionY.data();
+    float* angle = m_Angle.data();
+    const float* vx = m_VelocityX.data();
+    const float* vy = m_VelocityY.data();
+    const float* w = m_AngularVelocity.data();
+
+    const uint32_t count = m_AwakeCount;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        px[i] += vx[i] * dt;
+        py[i] += vy[i] * dt;
+        angle[i] += w[i] * dt;
+    }
+    // 이번 스텝 Collide 에서 깨어난 body (다음 Step 시작에 앞쪽으로 옮겨짐)
+    for (uint32_t i : m_WokenBodies)
+    {
+        px[i] += vx[i] * dt;
+        py[i] += vy[i] * dt;
+        angle[i] += w[i] * dt;
+    }
+}
+
+/**
+ * @brief 접촉 그래프로 island 를 만들고 오래 멈춘 island 를 재웁니다.
+ *
+ * 동적 body 끼리의 접촉만 union-find 로 묶고 (정적 body 는 island 를
+ * 잇지 않음), island 의 수면 시간은 구성 body 중 가장 짧은 값입니다.
+ * 잠드는 island 는 속도를 0 으로 하고 m_IslandNext / m_IslandPrev 원형
+ * 리스트로 묶어 나중에 한 번에 깨울 수 있게 합니다. 잠든 body 는 이번 스텝의
+ * 접촉 인덱스가 유효하도록 제자리에 두고 다음 Step 시작에 앞쪽 밖으로
+ * 옮깁니다.
+ */
+void World::UpdateSleep(float dt)
+{
+    CPE2D_PROFILE_SCOPE("World::UpdateSleep");
+    if (m_SleepingEnabled == false)
+        return;
+
+    // 밀집 인덱스로 쓰는 union-find 배열 (깨어 있는 body 칸만 초기화)
+    const size_t slotCount = m_Bodies.GetSize();
+    StackArena& arena = m_FrameArena.GetMain();
+    uint32_t* parent = arena.Allocate<uint32_t>(slotCount);
+    float* islandSleepTime = arena.Allocate<float>(slotCount);
+    uint32_t* islandFirst = arena.Allocate<uint32_t>(slotCount);
+
+    const float linearTolSq = LinearSleepTolerance * LinearSleepTolerance;
+    const float angularTolSq = AngularSleepTolerance * AngularSleepTolerance;
+    auto updateSleepTime = [&](uint32_t i)
+    {
+        const float vSq = m_VelocityX[i] * m_VelocityX[i] +
+                          m_VelocityY[i] * m_VelocityY[i];
+        const float w = m_AngularVelocity[i];
+        if (vSq > linearTolSq || w * w > angularTolSq)
+            m_SleepTime[i] = 0.0f;
+        else
+            m_SleepTime[i] += dt;
+
+        parent[i] = i;
+        islandSleepTime[i] = m_SleepTime[i];
+        islandFirst[i] = BodyHandle::InvalidIndex;
+    };
+    for (uint32_t i = 0; i < m_AwakeCount; ++i)
+        updateSleepTime(i);
+    for (uint32_t i : m_WokenBodies)
+        updateSleepTime(i);
+
+    for (const ContactManifold& contact : m_Contacts)
+    {
+        if (m_InvMass[contact.a] == 0.0f || m_InvMass[contact.b] == 0.0f)
+            continue;
+        uint32_t rootA = FindIslandRoot(parent, contact.a);
+        uint32_t rootB = FindIslandRoot(parent, contact.b);
+        if (rootA == rootB)
+            continue;
+        // 작은 인덱스를 루트로 두어 결과가 접촉 순서에만 의존하게 합니다.
+        if (rootB < rootA)
+            std::swap(rootA, rootB);
+        parent[rootB] = rootA;
+        islandSleepTime[rootA] =
+            std::min(islandSleepTime[rootA], islandSleepTime[rootB]);
+    }
+
+    // 잠들면 true
+    auto trySleep = [&](uint32_t i)
+    {
+        const uint32_t root = FindIslandRoot(parent, i);
+        if (islandSleepTime[root] < TimeToSleep)
+            return false;
+
+        m_Awake[i] = 0;
+        --m_AwakeBodyCount;
+        m_VelocityX[i] = 0.0f;
+        m_VelocityY[i] = 0.0f;
+        m_AngularVelocity[i] = 0.0f;
+
+        // island 의 첫 body 뒤에 끼워 넣어 원형 리스트를 유지합니다.
+        const uint32_t first = islandFirst[root];
+        if (first == BodyHandle::InvalidIndex)
+        {
+            islandFirst[root] = i;
+            m_IslandNext[i] = i;
+            m_IslandPrev[i] = i;
+            return true;
+        }
+        const uint32_t after = m_IslandNext[first];
+        m_IslandNext[i] = after;
+        m_IslandPrev[i] = first;
+        m_IslandPrev[after] = i;
+        m_IslandNext[first] = i;
+        return true;
+    };
+    for (uint32_t i = 0; i < m_AwakeCount; ++i)
+        trySleep(i);
+
+    // 잠든 body 는 목록에서 빼고 남은 body 의 위치를 다시 기록
+    uint32_t kept = 0;
+    for (const uint32_t i : m_WokenBodies)
+    {
+        if (trySleep(i))
+        {
+            m_WokenSlot[i] = BodyHandle::InvalidIndex;
+            continue;
+        }
+        m_WokenSlot[i] = kept;
+        m_WokenBodies[kept++] = i;
+    }
+    m_WokenBodies.resize(kept);
+}
+
+} // namespace CitadelPhysicsEngine2D
@@ -0,0 +1,37 @@
+#include <CitadelPhysicsEngine2D/dynamics/WorldSnapshot.h>
+
+#include <CitadelPhysicsEngine2D/dynamics/World.h>
+
+#include <cassert>
+
+namespace CitadelPhysicsEngine2D
+{
+
+WorldSnapshotRing::WorldSnapshotRing(uint32_t capacity)
+    : m_Snapshots(capacity), m_Frames(capacity, InvalidFrame)
+{
+    assert(capacity > 0);
+}
+
+void WorldSnapshotRing::Save(const World& world, uint32_t frame)
+{
+    assert(frame != InvalidFrame);
+    const uint32_t slot = frame % GetCapacity();
+    world.SaveSnapshot(m_Snapshots[slot]);
+    m_Frames[slot] = frame;
+}
+
+bool WorldSnapshotRing::Restore(World& world, uint32_t frame) const
+{
+    if (Contains(frame) == false)
+        return false;
+    world.RestoreSnapshot(m_Snapshots[frame % GetCapacity()]);
+    return true;
+}
+
+bool WorldSnapshotRing::Contains(uint32_t frame) const
+{
+    return frame != InvalidFrame && m_Frames[frame % GetCapacity()] == frame;
+}
+
+} // namespace CitadelPhysicsEngine2D
@@ -0,0 +1,49 @@
+#include <CitadelPhysicsEngine2D/memory/FrameArena.h>
+
+#include <cassert>
+
+namespace CitadelPhysicsEngine2D
+{
+
+FrameArena::FrameArena(size_t capacity)
+    : m_Capacity(capacity), m_Main(capacity)
+{
+    SetThreadCount(1);
+}
+
+/**
+ * @brief 하위 arena 수를 맞춥니다. 스텝 도중에는 부르면 안 됩니다.
+ */
+void FrameArena::SetThreadCount(uint32_t count)
+{
+    assert(count > 0);
+    // 하위 arena 는 작업 몇 개분만 쓰므로 주 arena 보다 작게 시작
+    while (m_ThreadArenas.size() < count)
+        m_ThreadArenas.push_back(std::make_unique<StackArena>(m_Capacity / 4));
+    m_ThreadArenas.resize(count);
+}
+
+void FrameArena::Reset()
+{
+    m_Main.Reset();
+    for (auto& arena : m_ThreadArenas)
+        arena->Reset();
+}
+
+size_t FrameArena::GetHighWaterMark() const
+{
+    size_t total = m_Main.GetHighWaterMark();
+    for (const auto& arena : m_ThreadArenas)
+        total += arena->GetHighWaterMark();
+    return total;
+}
+
+uint32_t FrameArena::GetOverflowCount() const
+{
+    uint32_t total = m_Main.GetOverflowCount();
+    for (const auto& arena : m_ThreadArenas)
+        total += arena->GetOverflowCount();
+    return total;
+}
+
+} // namespace CitadelPhysicsEngine2D
@@ -0,0 +1,105 @@
+#include <CitadelPhysicsEngine2D/memory/StackArena.h>
+
+#include <algorithm>
+#include <cassert>
+#include <new>
+
+namespace CitadelPhysicsEngine2D
+{
+
+namespace
+{
+
+// 버퍼와 넘친 블록의 정렬 (캐시 라인, AVX 폭 이상)
+constexpr size_t BlockAlignment = 64;
+
+void* AllocateBlock(size_t size)
+{
+    return ::operator new(size, std::align_val_t(BlockAlignment));
+}
+
+void FreeBlock(void* block)
+{
+    ::operator delete(block, std::align_val_t(BlockAlignment));
+}
+
+size_t AlignUp(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+} // namespace
+
+StackArena::StackArena(size_t capacity)
+{
+    if (capacity > 0)
+    {
+        m_Capacity = AlignUp(capacity, BlockAlignment);
+        m_Buffer = static_cast<uint8_t*>(AllocateBlock(m_Capacity));
+    }
+}
+
+StackArena::~StackArena()
+{
+    Reset();
+    if (m_Buffer != nullptr)
+        FreeBlock(m_Buffer);
+}
+
+/**
+ * @brief 정렬을 맞춰 size 바이트를 할당합니다.
+ *
+ * @param size 바이트 수
+ * @param alignment 2 의 거듭제곱, BlockAlignment 이하
+ */
+void* StackArena::Allocate(size_t size, size_t alignment)
+{
+    assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+    assert(alignment <= BlockAlignment);
+    if (size == 0)
+        size = 1;
+
+    // 버퍼 시작이 BlockAlignment 로 정렬되어 있으므로 오프셋만 맞추면 됨
+    const size_t offset = AlignUp(m_Used, alignment);
+    if (offset + size <= m_Capacity)
+    {
+        m_Used = offset + size;
+        m_HighWaterMark = std::max(m_HighWaterMark, GetUsed());
+        return m_Buffer + offset;
+    }
+
+    void* block = AllocateBlock(size);
+    m_Overflow.push_back(block);
+    m_OverflowBytes += AlignUp(size, alignment);
+    ++m_OverflowCount;
+    m_HighWaterMark = std::max(m_HighWaterMark, GetUsed());
+    return block;
+}
+
+void StackArena::FreeToMarker(size_t marker)
+{
+    assert(marker <= m_Used);
+    m_Used = marker;
+}
+
+void StackArena::Reset()
+{
+    for (void* block : m_Overflow)
+        FreeBlock(block);
+    const bool overflowed = m_Overflow.empty() == false;
+    m_Overflow.clear();
+    m_OverflowBytes = 0;
+    m_Used = 0;
+
+    // 다음 스텝이 조금 더 커도 넘치지 않도록 여유를 둠
+    if (overflowed && m_HighWaterMark > m_Capacity)
+    {
+        if (m_Buffer != nullptr)
+            FreeBlock(m_Buffer);
+        m_Capacity = AlignUp(m_HighWaterMark + m_HighWaterMark / 4,
+                             BlockAlignment);
+        m_Buffer = static_cast<uint8_t*>(AllocateBlock(m_Capacity));
+    }
+}
+
+} // namespace CitadelPhysicsEngine2D
@@ -0,0 +1,215 @@
+#include <CitadelPhysicsEngine2D/profiling/Profiler.h>
+
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace CitadelPhysicsEngine2D
+{
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+struct ProfilerState
+{
+    std::mutex mutex; // buffers 등록과 캡처 시작 / 끝 / 내보내기 보호
+    std::vector<std::unique_ptr<ProfileThreadBuffer>> buffers;
+
+    uint64_t startTick = 0;
+    uint64_t endTick = 0;
+    Clock::time_point startTime;
+    Clock::time_point endTime;
+};
+
+// 스레드가 끝난 뒤에도 이벤트를 내보낼 수 있도록 버퍼는 전역 상태가 가집니다.
+ProfilerState& GetState()
+{
+    static ProfilerState state;
+    return state;
+}
+
+thread_local ProfileThreadBuffer* t_Buffer = nullptr;
+
+// trace 이름은 코드의 문자열이므로 따옴표와 역슬래시만 처리합니다.
+void WriteString(std::ostream& out, const char* text)
+{
+    out << '"';
+    for (const char* c = text; *c != '\0'; ++c)
+    {
+        if (*c == '"' || *c == '\\')
+            out << '\\';
+        out << *c;
+    }
+    out << '"';
+}
+
+} // namespace
+
+std::atomic<bool> Profiler::s_Capturing{false};
+
+/**
+ * @brief 호출 스레드의 버퍼를 반환합니다. 처음 부르면 등록합니다.
+ *
+ * 캡처 도중 처음 등장한 스레드는 여기서 이벤트 배열을 받고, 그 전에 등록된
+ * 스레드는 BeginCapture 에서 받습니다.
+ */
+ProfileThreadBuffer& Profiler::GetThreadBuffer()
+{
+    if (t_Buffer != nullptr)
+        return *t_Buffer;
+
+    ProfilerState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto buffer = std::make_unique<ProfileThreadBuffer>();
+    buffer->m_ThreadId = static_cast<uint32_t>(state.buffers.size());
+    if (IsCapturing())
+    {
+        buffer->m_Events.reset(new ProfileEvent[ThreadEventCapacity]);
+        buffer->m_Capacity = ThreadEventCapacity;
+    }
+    t_Buffer = buffer.get();
+    state.buffers.push_back(std::move(buffer));
+    return *t_Buffer;
+}
+
+void Profiler::SetThreadName(const char* name)
+{
+    GetThreadBuffer().m_Name = name;
+}
+
+void Profiler::BeginCapture()
+{
+    ProfilerState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    for (auto& buffer : state.buffers)
+    {
+        if (buffer->m_Events == nullptr)
+        {
+            buffer->m_Events.reset(new ProfileEvent[ThreadEventCapacity]);
+            buffer->m_Capacity = ThreadEventCapacity;
+        }
+        buffer->m_Count.store(0);
+        buffer->m_Dropped.store(0);
+    }
+    state.startTime = Clock::now();
+    state.startTick = ReadClock();
+    state.endTick = state.startTick;
+    state.endTime = state.startTime;
+    s_Capturing.store(true);
+}
+
+void Profiler::EndCapture()
+{
+    if (IsCapturing() == false)
+        return;
+
+    s_Capturing.store(false);
+    ProfilerState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.endTick = ReadClock();
+    state.endTime = Clock::now();
+}
+
+uint32_t Profiler::GetEventCount()
+{
+    ProfilerState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    uint32_t count = 0;
+    for (const auto& buffer : state.buffers)
+        count += buffer->m_Count.load(std::memory_order_acquire);
+    return count;
+}
+
+uint64_t Profiler::GetDroppedEventCount()
+{
+    ProfilerState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    uint64_t dropped = 0;
+    for (const auto& buffer : state.buffers)
+        dropped += buffer->m_Dropped.load(std::memory_order_relaxed);
+    return dropped;
+}
+
+/**
+ * @brief 마지막 캡처를 Chrome trace-event JSON 으로 씁니다.
+ *
+ * 구역마다 완료 이벤트("ph": "X") 하나를 쓰고, 같은 스레드에서 시간 구간이
+ * 포함되는 이벤트는 뷰어가 부모 / 자식으로 쌓아 보여 줍니다. 틱은 캡처
+ * 시작 / 끝에서 잰 steady_clock 시간으로 비례 환산합니다. (캡처 중이면
+ * 지금까지)
+ */
+void Profiler::WriteChromeTrace(std::ostream& out)
+{
+    ProfilerState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    uint64_t endTick = state.endTick;
+    Clock::time_point endTime = state.endTime;
+    if (IsCapturing())
+    {
+        endTick = ReadClock();
+        endTime = Clock::now();
+    }
+    const double elapsedUs =
+        std::chrono::duration<double, std::micro>(endTime - state.startTime)
+            .count();
+    const double usPerTick =
+        endTick > state.startTick
+            ? elapsedUs / double(endTick - state.startTick)
+            : 0.0;
+
+    uint64_t dropped = 0;
+    for (const auto& buffer : state.buffers)
+        dropped += buffer->m_Dropped.load(std::memory_order_relaxed);
+
+    out << "{\"displayTimeUnit\":\"ms\",\"otherData\":{\"droppedEvents\":"
+        << dropped << "},\"traceEvents\":[";
+    bool first = true;
+    char number[64];
+    for (const auto& buffer : state.buffers)
+    {
+        const uint32_t count =
+            buffer->m_Count.load(std::memory_order_acquire);
+        if (count == 0 && buffer->m_Name == nullptr)
+            continue;
+
+        out << (first ? "\n" : ",\n");
+        first = false;
+        out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+            << buffer->m_ThreadId << ",\"args\":{\"name\":";
+        if (buffer->m_Name != nullptr)
+        {
+            WriteString(out, buffer->m_Name);
+        }
+        else
+        {
+            std::snprintf(number, sizeof(number), "Thread %u",
+                          buffer->m_ThreadId);
+            WriteString(out, number);
+        }
+        out << "}}";
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const ProfileEvent& event = buffer->m_Events[i];
+            const uint64_t begin =
+                event.begin > state.startTick ? event.begin : state.startTick;
+            const uint64_t end = event.end > begin ? event.end : begin;
+            out << ",\n{\"name\":";
+            WriteString(out, event.name);
+            std::snprintf(number, sizeof(number),
+                          ",\"ts\":%.3f,\"dur\":%.3f",
+                          double(begin - state.startTick) * usPerTick,
+                          double(end - begin) * usPerTick);
+            out << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->m_ThreadId
+                << number << '}';
+        }
+    }
+    out << "\n]}\n";
+}
+
+} // namespace CitadelPhysicsEngine2D
@@ -3,6 +3,31 @@
 namespace CitadelPhysicsEngine2D
 {
 
+/**
+ * @brief 둘레를 계산합니다. (2D 에서의 표면적 휴리스틱 비용)
+ */
+float AABB::GetPerimeter() const
+{
+    return 2.0f * ((max.x - min.x) + (max.y - min.y));
+}
+
+/**
+ * @brief other 가 이 AABB 안에 완전히 포함되는지 확인합니다.
+ */
+bool AABB::Contains(const AABB& other) const
+{
+    return min.x <= other.min.x && min.y <= other.min.y &&
+           other.max.x <= max.x && other.max.y <= max.y;
+}
+
+/**
+ * @brief 두 AABB 를 모두 감싸는 최소 AABB 를 계산합니다.
+ */
+AABB AABB::Combine(const AABB& a, const AABB& b)
+{
+    return AABB(glm::min(a.min, b.min), glm::max(a.max, b.max));
+}
+
 /**
  * @brief 두 AABB의 충돌 여부를 확인합니다.
  *
@@ -0,0 +1,245 @@
+#include <CitadelPhysicsEngine2D/shapes/AABBSoA.h>
+
+#include <cstring>
+
+namespace CitadelPhysicsEngine2D
+{
+
+namespace
+{
+
+// 배열 [i, last) 를 query 와 비교하여 충돌한 원소를 sink(base, bits) 로
+// 전달합니다. bits 의 k 번째 비트는 base + k 원소의 충돌 여부입니다.
+// 분리 조건은 AABB::AABBvsAABB 와 동일한 순서/비교를 사용합니다.
+template <typename Sink>
+void ScanScalar(const AABBSoA& soa, const AABB& q, uint32_t i, uint32_t last,
+                Sink& sink)
+{
+    const float* minX = soa.MinX();
+    const float* minY = soa.MinY();
+    const float* maxX = soa.MaxX();
+    const float* maxY = soa.MaxY();
+
+    for (; i < last; ++i)
+    {
+        bool separated = (maxX[i] < q.min.x || minX[i] > q.max.x) ||
+                         (maxY[i] < q.min.y || minY[i] > q.max.y);
+        if (separated == false)
+            sink(i, 1u);
+    }
+}
+
+#if defined(CPE2D_SIMD_SSE2)
+template <typename Sink>
+uint32_t ScanSSE2(const AABBSoA& soa, const AABB& q, uint32_t i,
+                  uint32_t last, Sink& sink)
+{
+    const __m128 qMinX = _mm_set1_ps(q.min.x);
+    const __m128 qMinY = _mm_set1_ps(q.min.y);
+    const __m128 qMaxX = _mm_set1_ps(q.max.x);
+    const __m128 qMaxY = _mm_set1_ps(q.max.y);
+
+    for (; i + 4 <= last; i += 4)
+    {
+        __m128 sepX =
+            _mm_or_ps(_mm_cmplt_ps(_mm_loadu_ps(soa.MaxX() + i), qMinX),
+                      _mm_cmpgt_ps(_mm_loadu_ps(soa.MinX() + i), qMaxX));
+        __m128 sepY =
+            _mm_or_ps(_mm_cmplt_ps(_mm_loadu_ps(soa.MaxY() + i), qMinY),
+                      _mm_cmpgt_ps(_mm_loadu_ps(soa.MinY() + i), qMaxY));
+        uint32_t bits =
+            ~static_cast<uint32_t>(_mm_movemask_ps(_mm_or_ps(sepX, sepY))) &
+            0xFu;
+        if (bits != 0)
+            sink(i, bits);
+    }
+    return i;
+}
+#endif
+
+#if defined(CPE2D_SIMD_AVX2)
+template <typename Sink>
+uint32_t ScanAVX2(const AABBSoA& soa, const AABB& q, uint32_t i,
+                  uint32_t last, Sink& sink)
+{
+    const __m256 qMinX = _mm256_set1_ps(q.min.x);
+    const __m256 qMinY = _mm256_set1_ps(q.min.y);
+    const __m256 qMaxX = _mm256_set1_ps(q.max.x);
+    const __m256 qMaxY = _mm256_set1_ps(q.max.y);
+
+    for (; i + 8 <= last; i += 8)
+    {
+        __m256 sepX = _mm256_or_ps(
+            _mm256_cmp_ps(_mm256_loadu_ps(soa.MaxX() + i), qMinX, _CMP_LT_OQ),
+            _mm256_cmp_ps(_mm256_loadu_ps(soa.MinX() + i), qMaxX, _CMP_GT_OQ));
+        __m256 sepY = _mm256_or_ps(
+            _mm256_cmp_ps(_mm256_loadu_ps(soa.MaxY() + i), qMinY, _CMP_LT_OQ),
+            _mm256_cmp_ps(_mm256_loadu_ps(soa.MinY() + i), qMaxY, _CMP_GT_OQ));
+        uint32_t bits = ~static_cast<uint32_t>(
+                            _mm256_movemask_ps(_mm256_or_ps(sepX, sepY))) &
+                        0xFFu;
+        if (bits != 0)
+            sink(i, bits);
+    }
+    return i;
+}
+#endif
+
+template <typename Sink>
+void Scan(const AABBSoA& soa, const AABB& q, uint32_t first, uint32_t last,
+          SimdLevel level, Sink& sink)
+{
+    uint32_t i = first;
+#if defined(CPE2D_SIMD_AVX2)
+    if (level == SimdLevel::AVX2)
+        i = ScanAVX2(soa, q, i, last, sink);
+#endif
+#if defined(CPE2D_SIMD_SSE2)
+    if (level != SimdLevel::Scalar)
+        i = ScanSSE2(soa, q, i, last, sink);
+#endif
+    ScanScalar(soa, q, i, last, sink);
+}
+
+} // namespace
+
+AABBSoA::AABBSoA(StackArena* arena)
+    : m_MinX(AlignedAllocator<float>(arena)),
+      m_MinY(AlignedAllocator<float>(arena)),
+      m_MaxX(AlignedAllocator<float>(arena)),
+      m_MaxY(AlignedAllocator<float>(arena))
+{
+}
+
+uint32_t AABBSoA::Add(const AABB& box)
+{
+    m_MinX.push_back(box.min.x);
+    m_MinY.push_back(box.min.y);
+    m_MaxX.push_back(box.max.x);
+    m_MaxY.push_back(box.max.y);
+    return Size() - 1;
+}
+
+void AABBSoA::Set(uint32_t index, const AABB& box)
+{
+    m_MinX[index] = box.min.x;
+    m_MinY[index] = box.min.y;
+    m_MaxX[index] = box.max.x;
+    m_MaxY[index] = box.max.y;
+}
+
+AABB AABBSoA::Get(uint32_t index) const
+{
+    return AABB({m_MinX[index], m_MinY[index]}, {m_MaxX[index], m_MaxY[index]});
+}
+
+void AABBSoA::Reserve(size_t capacity)
+{
+    m_MinX.reserve(capacity);
+    m_MinY.reserve(capacity);
+    m_MaxX.reserve(capacity);
+    m_MaxY.reserve(capacity);
+}
+
+void AABBSoA::Clear()
+{
+    m_MinX.clear();
+    m_MinY.clear();
+    m_MaxX.clear();
+    m_MaxY.clear();
+}
+
+/**
+ * @brief query 와 충돌하는 원소를 비트마스크로 기록합니다.
+ *
+ * @param query 질의 AABB
+ * @param outMask (Size() + 31) / 32 워드 크기의 출력 버퍼
+ * @param level 사용할 SIMD 경로
+ * @return uint32_t 충돌한 원소 수
+ */
+uint32_t AABBSoA::QueryOverlapMask(const AABB& query, uint32_t* outMask,
+                                   SimdLevel level) const
+{
+    std::memset(outMask, 0, ((Size() + 31) / 32) * sizeof(uint32_t));
+
+    // SIMD 청크는 0 에서 시작해 4/8 단위로 진행하므로 한 워드를 넘지 않습니다.
+    uint32_t count = 0;
+    auto sink = [&](uint32_t base, uint32_t bits)
+    {
+        outMask[base >> 5] |= bits << (base & 31);
+        count += PopCount(bits);
+    };
+    Scan(*this, query, 0, Size(), level, sink);
+    return count;
+}
+
+/**
+ * @brief query 와 충돌하는 원소의 인덱스를 오름차순으로 기록합니다.
+ *
+ * @param query 질의 AABB
+ * @param outIndices 최소 Size() 개 크기의 출력 버퍼
+ * @param level 사용할 SIMD 경로
+ * @return uint32_t 기록된 인덱스 수
+ */
+uint32_t AABBSoA::QueryOverlapIndices(const AABB& query, uint32_t* outIndices,
+                                      SimdLevel level) const
+{
+    uint32_t count = 0;
+    auto sink = [&](uint32_t base, uint32_t bits)
+    {
+        while (bits != 0)
+        {
+            outIndices[count++] = base + CountTrailingZeros(bits);
+            bits &= bits - 1;
+        }
+    };
+    Scan(*this, query, 0, Size(), level, sink);
+    return count;
+}
+
+void AABBSoA::QueryOverlapRange(const AABB& query, uint32_t first,
+                                uint32_t last, uint32_t queryIndex,
+                                std::vector<OverlapPair>& outPairs,
+                                SimdLevel level) const
+{
+    auto sink = [&](uint32_t base, uint32_t bits)
+    {
+        while (bits != 0)
+        {
+            outPairs.push_back({queryIndex, base + CountTrailingZeros(bits)});
+            bits &= bits - 1;
+        }
+    };
+    Scan(*this, query, first, last, level, sink);
+}
+
+/**
+ * @brief this 의 각 원소를 other 전체와 비교합니다. (many-vs-many)
+ *
+ * 결과는 (this 인덱스, other 인덱스) 사전순으로 추가됩니다.
+ */
+void AABBSoA::QueryOverlapPairs(const AABBSoA& other,
+                                std::vector<OverlapPair>& outPairs,
+                                SimdLevel level) const
+{
+    for (uint32_t a = 0; a < Size(); ++a)
+    {
+        other.QueryOverlapRange(Get(a), 0, other.Size(), a, outPairs, level);
+    }
+}
+
+/**
+ * @brief 컨테이너 내부의 모든 a < b 충돌 쌍을 찾습니다.
+ *
+ * 결과는 (a, b) 사전순으로 추가됩니다.
+ */
+void AABBSoA::QuerySelfOverlapPairs(std::vector<OverlapPair>& outPairs,
+                                    SimdLevel level) const
+{
+    for (uint32_t a = 0; a < Size(); ++a)
+    {
+        QueryOverlapRange(Get(a), a + 1, Size(), a, outPairs, level);
+    }
+}
+
+} // namespace CitadelPhysicsEngine2D
@@ -3,6 +3,15 @@
 namespace CitadelPhysicsEngine2D
 {
 
+/**
+ * @brief 원을 감싸는 AABB 를 계산합니다. (broadphase 용)
+ */
+AABB Circle::GetAABB() const
+{
+    glm::vec2 extent(radius, radius);
+    return AABB(position - extent, position + extent);
+}
+
 /**
  * @brief 두 원의 충돌 여부를 확인합니다.
  *
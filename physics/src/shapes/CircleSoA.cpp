@@ -0,0 +1,205 @@
+#include <CitadelPhysicsEngine2D/shapes/CircleSoA.h>
+
+namespace CitadelPhysicsEngine2D
+{
+
+namespace
+{
+
+// Circle::CirclevsCircle 과 같은 연산 순서로 계산해야 SIMD 결과가
+// 스칼라 결과와 비트 단위로 일치합니다. (FMA 미사용)
+template <typename Sink>
+void ScanScalar(const CircleSoA& soa, const Circle& q, uint32_t i,
+                uint32_t last, Sink& sink)
+{
+    const float* px = soa.X();
+    const float* py = soa.Y();
+    const float* pr = soa.Radius();
+
+    for (; i < last; ++i)
+    {
+        float r = q.radius + pr[i];
+        float x = q.position.x - px[i];
+        float y = q.position.y - py[i];
+        bool separated = (r * r) < ((x * x) + (y * y));
+        if (separated == false)
+            sink(i, 1u);
+    }
+}
+
+#if defined(CPE2D_SIMD_SSE2)
+template <typename Sink>
+uint32_t ScanSSE2(const CircleSoA& soa, const Circle& q, uint32_t i,
+                  uint32_t last, Sink& sink)
+{
+    const __m128 qx = _mm_set1_ps(q.position.x);
+    const __m128 qy = _mm_set1_ps(q.position.y);
+    const __m128 qr = _mm_set1_ps(q.radius);
+
+    for (; i + 4 <= last; i += 4)
+    {
+        __m128 r = _mm_add_ps(qr, _mm_loadu_ps(soa.Radius() + i));
+        __m128 x = _mm_sub_ps(qx, _mm_loadu_ps(soa.X() + i));
+        __m128 y = _mm_sub_ps(qy, _mm_loadu_ps(soa.Y() + i));
+        __m128 distSq = _mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y));
+        __m128 separated = _mm_cmplt_ps(_mm_mul_ps(r, r), distSq);
+        uint32_t bits =
+            ~static_cast<uint32_t>(_mm_movemask_ps(separated)) & 0xFu;
+        if (bits != 0)
+            sink(i, bits);
+    }
+    return i;
+}
+#endif
+
+#if defined(CPE2D_SIMD_AVX2)
+template <typename Sink>
+uint32_t ScanAVX2(const CircleSoA& soa, const Circle& q, uint32_t i,
+                  uint32_t last, Sink& sink)
+{
+    const __m256 qx = _mm256_set1_ps(q.position.x);
+    const __m256 qy = _mm256_set1_ps(q.position.y);
+    const __m256 qr = _mm256_set1_ps(q.radius);
+
+    for (; i + 8 <= last; i += 8)
+    {
+        __m256 r = _mm256_add_ps(qr, _mm256_loadu_ps(soa.Radius() + i));
+        __m256 x = _mm256_sub_ps(qx, _mm256_loadu_ps(soa.X() + i));
+        __m256 y = _mm256_sub_ps(qy, _mm256_loadu_ps(soa.Y() + i));
+        __m256 distSq =
+            _mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y));
+        __m256 separated =
+            _mm256_cmp_ps(_mm256_mul_ps(r, r), distSq, _CMP_LT_OQ);
+        uint32_t bits =
+            ~static_cast<uint32_t>(_mm256_movemask_ps(separated)) & 0xFFu;
+        if (bits != 0)
+            sink(i, bits);
+    }
+    return i;
+}
+#endif
+
+template <typename Sink>
+void Scan(const CircleSoA& soa, const Circle& q, uint32_t first,
+          uint32_t last, SimdLevel level, Sink& sink)
+{
+    uint32_t i = first;
+#if defined(CPE2D_SIMD_AVX2)
+    if (level == SimdLevel::AVX2)
+        i = ScanAVX2(soa, q, i, last, sink);
+#endif
+#if defined(CPE2D_SIMD_SSE2)
+    if (level != SimdLevel::Scalar)
+        i = ScanSSE2(soa, q, i, last, sink);
+#endif
+    ScanScalar(soa, q, i, last, sink);
+}
+
+} // namespace
+
+CircleSoA::CircleSoA(StackArena* arena)
+    : m_X(AlignedAllocator<float>(arena)),
+      m_Y(AlignedAllocator<float>(arena)),
+      m_Radius(AlignedAllocator<float>(arena))
+{
+}
+
+uint32_t CircleSoA::Add(const Circle& circle)
+{
+    m_X.push_back(circle.position.x);
+    m_Y.push_back(circle.position.y);
+    m_Radius.push_back(circle.radius);
+    return Size() - 1;
+}
+
+void CircleSoA::Set(uint32_t index, const Circle& circle)
+{
+    m_X[index] = circle.position.x;
+    m_Y[index] = circle.position.y;
+    m_Radius[index] = circle.radius;
+}
+
+Circle CircleSoA::Get(uint32_t index) const
+{
+    return Circle(m_Radius[index], {m_X[index], m_Y[index]});
+}
+
+void CircleSoA::Reserve(size_t capacity)
+{
+    m_X.reserve(capacity);
+    m_Y.reserve(capacity);
+    m_Radius.reserve(capacity);
+}
+
+void CircleSoA::Clear()
+{
+    m_X.clear();
+    m_Y.clear();
+    m_Radius.clear();
+}
+
+/**
+ * @brief [first, last) 범위에서 query 와 충돌하는 원의 인덱스를 찾습니다.
+ *
+ * @param query 질의 원
+ * @param first 검사 시작 인덱스
+ * @param last 검사 끝 인덱스 (미포함)
+ * @param outIndices 최소 (last - first) 개 크기의 출력 버퍼
+ * @param level 사용할 SIMD 경로
+ * @return uint32_t 기록된 인덱스 수
+ */
+uint32_t CircleSoA::QueryOverlapIndices(const Circle& query, uint32_t first,
+                                        uint32_t last, uint32_t* outIndices,
+                                        SimdLevel level) const
+{
+    uint32_t count = 0;
+    auto sink = [&](uint32_t base, uint32_t bits)
+    {
+        while (bits != 0)
+        {
+            outIndices[count++] = base + CountTrailingZeros(bits);
+            bits &= bits - 1;
+        }
+    };
+    Scan(*this, query, first, last, level, sink);
+    return count;
+}
+
+/**
+ * @brief 타일 내의 모든 충돌 쌍을 찾습니다.
+ *
+ * 결과는 (a, b) 사전순이며, capacity 를 넘는 쌍은 세기만 합니다.
+ * 반환값이 capacity 보다 크면 더 큰 버퍼로 다시 질의해야 합니다.
+ *
+ * @return uint32_t 찾은 전체 쌍의 수
+ */
+uint32_t CircleSoA::QueryTileOverlapPairs(uint32_t firstA, uint32_t lastA,
+                                          uint32_t firstB, uint32_t lastB,
+                                          OverlapPair* outPairs,
+                                          uint32_t capacity,
+                                          SimdLevel level) const
+{
+    const bool diagonal = (firstA == firstB && lastA == lastB);
+
+    uint32_t count = 0;
+    uint32_t a = 0;
+    auto sink = [&](uint32_t base, uint32_t bits)
+    {
+        while (bits != 0)
+        {
+            if (count < capacity)
+                outPairs[count] = {a, base + CountTrailingZeros(bits)};
+            ++count;
+            bits &= bits - 1;
+        }
+    };
+
+    for (a = firstA; a < lastA; ++a)
+    {
+        uint32_t first = diagonal ? a + 1 : firstB;
+        Scan(*this, Get(a), first, lastB, level, sink);
+    }
+    return count;
+}
+
+} // namespace CitadelPhysicsEngine2D
@@ -0,0 +1,65 @@
+#include <CitadelPhysicsEngine2D/shapes/OBB.h>
+
+#include <cmath>
+
+namespace CitadelPhysicsEngine2D
+{
+
+OBB::OBB(const glm::vec2& center, const glm::vec2& halfExtents, float angle)
+    : center(center), halfExtents(halfExtents)
+{
+    SetAngle(angle);
+}
+
+void OBB::SetAngle(float angle)
+{
+    float c = std::cos(angle);
+    float s = std::sin(angle);
+    axes[0] = {c, s};
+    axes[1] = {-s, c};
+}
+
+Transform2D OBB::GetTransform() const
+{
+    Transform2D xf;
+    xf.position = center;
+    xf.rotation = axes[0];
+    return xf;
+}
+
+AABB OBB::GetAABB() const
+{
+    glm::vec2 extent(std::abs(axes[0].x) * halfExtents.x +
+                         std::abs(axes[1].x) * halfExtents.y,
+                     std::abs(axes[0].y) * halfExtents.x +
+                         std::abs(axes[1].y) * halfExtents.y);
+    return AABB(center - extent, center + extent);
+}
+
+/**
+ * @brief 두 OBB 의 충돌 여부를 분리축 정리로 확인합니다.
+ *
+ * 첫 번째 분리축을 찾는 즉시 반환합니다.
+ *
+ * @return true 충돌하지 않는 경우
+ * @return false 충돌하는 경우
+ */
+bool OBB::OBBvsOBB(const OBB& a, const OBB& b)
+{
+    const glm::vec2 d = b.center - a.center;
+    const glm::vec2* axes[4] = {&a.axes[0], &a.axes[1], &b.axes[0],
+                                &b.axes[1]};
+
+    for (const glm::vec2* axis : axes)
+    {
+        float ra = a.halfExtents.x * std::abs(glm::dot(a.axes[0], *axis)) +
+                   a.halfExtents.y * std::abs(glm::dot(a.axes[1], *axis));
+        float rb = b.halfExtents.x * std::abs(glm::dot(b.axes[0], *axis)) +
+                   b.halfExtents.y * std::abs(glm::dot(b.axes[1], *axis));
+        if (std::abs(glm::dot(d, *axis)) > ra + rb)
+            return true;
+    }
+    return false;
+}
+
+} // namespace CitadelPhysicsEngine2D
@@ -0,0 +1,59 @@
+#include <CitadelPhysicsEngine2D/shapes/Polygon.h>
+
+#include <cassert>
+
+namespace CitadelPhysicsEngine2D
+{
+
+/**
+ * @brief 반시계 방향 볼록 정점으로 다각형을 만들고 변 법선을 계산합니다.
+ *
+ * @param points 정점 배열 (반시계 방향, 볼록)
+ * @param pointCount 정점 수 (3 ~ MaxVertices)
+ */
+Polygon::Polygon(const glm::vec2* points, uint32_t pointCount)
+    : count(pointCount)
+{
+    assert(pointCount >= 3 && pointCount <= MaxVertices);
+
+    glm::vec2 sum(0.0f);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        vertices[i] = points[i];
+        sum += points[i];
+    }
+    centroid = sum / float(count);
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        glm::vec2 edge = vertices[(i + 1) % count] - vertices[i];
+        normals[i] = glm::normalize(glm::vec2(edge.y, -edge.x));
+    }
+}
+
+Polygon Polygon::MakeBox(const glm::vec2& halfExtents)
+{
+    const glm::vec2 points[4] = {{-halfExtents.x, -halfExtents.y},
+                                 {halfExtents.x, -halfExtents.y},
+                                 {halfExtents.x, halfExtents.y},
+                                 {-halfExtents.x, halfExtents.y}};
+    return Polygon(points, 4);
+}
+
+/**
+ * @brief 변환된 다각형을 감싸는 AABB 를 계산합니다.
+ */
+AABB Polygon::GetAABB(const Transform2D& xf) const
+{
+    glm::vec2 lo = xf.Apply(vertices[0]);
+    glm::vec2 hi = lo;
+    for (uint32_t i = 1; i < count; ++i)
+    {
+        glm::vec2 v = xf.Apply(vertices[i]);
+        lo = glm::min(lo, v);
+        hi = glm::max(hi, v);
+    }
+    return AABB(lo, hi);
+}
+
+} // namespace CitadelPhysicsEngine2D
@@ -0,0 +1,426 @@
+#include <CitadelPhysicsEngine2D/threading/JobSystem.h>
+
+#include <CitadelPhysicsEngine2D/profiling/Profiler.h>
+
+#include <algorithm>
+#include <cassert>
+
+namespace CitadelPhysicsEngine2D
+{
+
+namespace
+{
+
+// 큐가 빈 작업 스레드가 잠들기 전에 양보하며 기다리는 횟수
+// 솔버처럼 짧은 병렬 for 가 연달아 올 때 매번 깨우는 비용을 줄입니다.
+constexpr uint32_t SpinCount = 128;
+constexpr uint32_t QueueMask = JobSystem::MaxJobs - 1;
+static_assert((JobSystem::MaxJobs & QueueMask) == 0,
+              "MaxJobs must be a power of two");
+
+// 작업 스레드가 자기 큐 번호를 찾는 데 씁니다.
+thread_local const JobSystem* t_JobSystem = nullptr;
+thread_local uint32_t t_QueueIndex = 0;
+
+} // namespace
+
+struct JobSystem::Job
+{
+    Function function;
+    // 병렬 for: 루트 작업만 함수를 가지고, 나눠진 구간은 루트를 가리킵니다.
+    RangeFunction rangeStorage; // ScheduleParallelFor 가 복사한 함수
+    RangeInvoker invoke = nullptr;
+    const void* context = nullptr;
+    bool isRange = false;
+    uint32_t root = 0; // 구간 작업의 루트 (아니면 자기 자신)
+    uint32_t begin = 0;
+    uint32_t end = 0;
+    uint32_t grain = 1;
+
+    std::atomic<uint32_t> unfinished{0}; // 자기 + 안 끝난 구간 작업
+    std::atomic<uint32_t> waitingFor{0}; // 안 끝난 선행 작업
+    std::atomic<uint32_t> generation{0};
+
+    std::mutex mutex; // finished / dependents 보호
+    bool finished = false;
+    std::vector<uint32_t> dependents; // 이 작업을 기다리는 작업
+};
+
+// 작업 인덱스 링 버퍼
+// 주인은 tail 쪽에서 넣고 꺼내고, 다른 스레드는 head 쪽에서 훔칩니다.
+// 살아 있는 작업이 MaxJobs 개 이하이므로 넘치지 않습니다.
+struct JobSystem::Queue
+{
+    std::mutex mutex;
+    std::vector<uint32_t> jobs;
+    std::atomic<uint32_t> head{0};
+    std::atomic<uint32_t> tail{0};
+
+    bool IsEmpty() const { return head.load() == tail.load(); }
+};
+
+JobSystem::JobSystem(uint32_t threadCount)
+{
+    if (threadCount == 0)
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    m_ThreadCount = threadCount;
+
+    m_Jobs = std::make_unique<Job[]>(MaxJobs);
+    m_FreeJobs.reserve(MaxJobs);
+    for (uint32_t i = MaxJobs; i > 0; --i)
+        m_FreeJobs.push_back(i - 1);
+
+    m_Queues = std::make_unique<Queue[]>(threadCount);
+    for (uint32_t i = 0; i < threadCount; ++i)
+        m_Queues[i].jobs.resize(MaxJobs);
+
+    m_Workers.reserve(threadCount - 1);
+    for (uint32_t i = 1; i < threadCount; ++i)
+        m_Workers.emplace_back(&JobSystem::WorkerLoop, this, i);
+}
+
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_WakeMutex);
+        m_Stopping = true;
+    }
+    m_WakeCondition.notify_all();
+
+    for (std::thread& worker : m_Workers)
+        worker.join();
+}
+
+uint32_t JobSystem::GetCurrentThreadIndex() const
+{
+    return t_JobSystem == this ? t_QueueIndex : 0;
+}
+
+/**
+ * @brief 빈 작업 슬롯을 꺼냅니다. 없으면 작업을 실행하며 기다립니다.
+ */
+uint32_t JobSystem::AllocateJob()
+{
+    for (;;)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_FreeMutex);
+            if (m_FreeJobs.empty() == false)
+            {
+                const uint32_t index = m_FreeJobs.back();
+                m_FreeJobs.pop_back();
+                return index;
+            }
+        }
+        if (TryRunOne(GetCurrentThreadIndex()) == false)
+            std::this_thread::yield();
+    }
+}
+
+/**
+ * @brief 끝난 작업의 슬롯을 비우고 세대를 올려 기존 핸들을 무효화합니다.
+ */
+void JobSystem::ReleaseJob(uint32_t index)
+{
+    Job& job = m_Jobs[index];
+    {
+        std::lock_guard<std::mutex> lock(job.mutex);
+        job.function = nullptr;
+        job.rangeStorage = nullptr;
+        job.invoke = nullptr;
+        job.context = nullptr;
+        job.finished = false;
+        job.dependents.clear();
+        job.generation.fetch_add(1);
+    }
+    std::lock_guard<std::mutex> lock(m_FreeMutex);
+    m_FreeJobs.push_back(index);
+}
+
+/**
+ * @brief 선행 작업에 등록하고, 기다릴 것이 없으면 바로 큐에 넣습니다.
+ *
+ * 등록하는 동안 선행 작업이 끝나 실행되지 않도록 waitingFor 를 1 로
+ * 시작해 마지막에 뺍니다.
+ */
+JobHandle JobSystem::Submit(uint32_t index, const JobHandle* dependencies,
+                            uint32_t dependencyCount)
+{
+    Job& job = m_Jobs[index];
+    job.waitingFor.store(1);
+    for (uint32_t i = 0; i < dependencyCount; ++i)
+    {
+        const JobHandle dependency = dependencies[i];
+        if (dependency.index == JobHandle::InvalidIndex)
+            continue;
+
+        Job& other = m_Jobs[dependency.index];
+        std::lock_guard<std::mutex> lock(other.mutex);
+        if (other.generation.load() != dependency.generation ||
+            other.finished)
+            continue;
+        other.dependents.push_back(index);
+        job.waitingFor.fetch_add(1);
+    }
+
+    // Push 이후에는 작업이 끝나 슬롯이 재사용될 수 있으므로 먼저 핸들을 만듦
+    const JobHandle handle = {index, job.generation.load()};
+    if (job.waitingFor.fetch_sub(1) == 1)
+        Push(index);
+    return handle;
+}
+
+JobHandle JobSystem::Schedule(Function function,
+                              const JobHandle* dependencies,
+                              uint32_t dependencyCount)
+{
+    const uint32_t index = AllocateJob();
+    Job& job = m_Jobs[index];
+    job.function = std::move(function);
+    job.isRange = false;
+    job.root = index;
+    job.unfinished.store(1);
+    return Submit(index, dependencies, dependencyCount);
+}
+
+JobHandle JobSystem::SubmitRange(uint32_t index, uint32_t count,
+                                 uint32_t grain,
+                                 const JobHandle* dependencies,
+                                 uint32_t dependencyCount)
+{
+    Job& job = m_Jobs[index];
+    job.isRange = true;
+    job.root = index;
+    job.begin = 0;
+    job.end = count;
+    job.grain = std::max(1u, grain);
+    job.unfinished.store(1);
+    return Submit(index, dependencies, dependencyCount);
+}
+
+JobHandle JobSystem::ScheduleParallelFor(uint32_t count, uint32_t grain,
+                                         RangeFunction function,
+                                         const JobHandle* dependencies,
+                                         uint32_t dependencyCount)
+{
+    if (count == 0)
+        return Schedule(Function(), dependencies, dependencyCount);
+
+    const uint32_t index = AllocateJob();
+    Job& job = m_Jobs[index];
+    job.rangeStorage = std::move(function);
+    job.invoke = &InvokeRange<RangeFunction>;
+    job.context = &job.rangeStorage;
+    return SubmitRange(index, count, grain, dependencies, dependencyCount);
+}
+
+/**
+ * @brief [0, count) 를 grain 개 이하 구간으로 나눠 병렬로 실행하고
+ *        모두 끝날 때까지 기다립니다.
+ *
+ * context 는 호출자 스택에 있으므로 복사하지 않고 끝날 때까지 기다립니다.
+ */
+void JobSystem::RunParallelFor(uint32_t count, uint32_t grain,
+                               RangeInvoker invoke, const void* context)
+{
+    const uint32_t index = AllocateJob();
+    m_Jobs[index].invoke = invoke;
+    m_Jobs[index].context = context;
+    Wait(SubmitRange(index, count, grain, nullptr, 0));
+}
+
+bool JobSystem::IsDone(JobHandle handle) const
+{
+    if (handle.index == JobHandle::InvalidIndex)
+        return true;
+    return m_Jobs[handle.index].generation.load() != handle.generation;
+}
+
+void JobSystem::Wait(JobHandle handle)
+{
+    const uint32_t queueIndex = GetCurrentThreadIndex();
+    while (IsDone(handle) == false)
+    {
+        if (TryRunOne(queueIndex) == false)
+            std::this_thread::yield();
+    }
+}
+
+void JobSystem::Push(uint32_t index)
+{
+    Queue& queue = m_Queues[GetCurrentThreadIndex()];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        const uint32_t tail = queue.tail.load();
+        assert(tail - queue.head.load() < MaxJobs);
+        queue.jobs[tail & QueueMask] = index;
+        queue.tail.store(tail + 1);
+    }
+
+    // 잠든 스레드는 m_QueuedJobs 를 확인한 뒤 잠들므로, 늘린 뒤 잠든 수를
+    // 보면 깨우기를 놓치지 않습니다.
+    m_QueuedJobs.fetch_add(1);
+    if (m_SleepingWorkers.load() > 0)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_WakeMutex);
+        }
+        m_WakeCondition.notify_one();
+    }
+}
+
+bool JobSystem::TryPop(uint32_t queueIndex, uint32_t& index)
+{
+    Queue& queue = m_Queues[queueIndex];
+    if (queue.IsEmpty())
+        return false;
+
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    const uint32_t tail = queue.tail.load();
+    if (tail == queue.head.load())
+        return false;
+    index = queue.jobs[(tail - 1) & QueueMask];
+    queue.tail.store(tail - 1);
+    m_QueuedJobs.fetch_sub(1);
+    return true;
+}
+
+/**
+ * @brief 다른 큐의 가장 오래된 작업을 가져옵니다.
+ *
+ * 오래된 작업일수록 나누기 전의 큰 구간이므로 한 번 훔쳐 오래 일합니다.
+ */
+bool JobSystem::TrySteal(uint32_t queueIndex, uint32_t& index)
+{
+    const uint32_t queueCount = GetThreadCount();
+    for (uint32_t i = 1; i < queueCount; ++i)
+    {
+        Queue& queue = m_Queues[(queueIndex + i) % queueCount];
+        if (queue.IsEmpty())
+            continue;
+
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        const uint32_t head = queue.head.load();
+        if (head == queue.tail.load())
+            continue;
+        index = queue.jobs[head & QueueMask];
+        queue.head.store(head + 1);
+        m_QueuedJobs.fetch_sub(1);
+        return true;
+    }
+    return false;
+}
+
+bool JobSystem::TryRunOne(uint32_t queueIndex)
+{
+    uint32_t index;
+    if (TryPop(queueIndex, index) == false &&
+        TrySteal(queueIndex, index) == false)
+        return false;
+    Execute(index);
+    return true;
+}
+
+/**
+ * @brief 작업 하나를 실행합니다.
+ *
+ * 구간 작업은 grain 개 이하가 될 때까지 뒤쪽 절반을 새 작업으로 떼어
+ * 큐에 넣고 앞쪽 절반을 계속 나눈 뒤 남은 구간을 직접 실행합니다.
+ */
+void JobSystem::Execute(uint32_t index)
+{
+    CPE2D_PROFILE_SCOPE("JobSystem::Execute");
+    Job& job = m_Jobs[index];
+    if (job.isRange)
+    {
+        Job& root = m_Jobs[job.root];
+        uint32_t begin = job.begin;
+        uint32_t end = job.end;
+        while (end - begin > root.grain)
+        {
+            const uint32_t middle = begin + (end - begin) / 2;
+            const uint32_t child = AllocateJob();
+            Job& split = m_Jobs[child];
+            split.isRange = true;
+            split.root = job.root;
+            split.begin = middle;
+            split.end = end;
+            split.unfinished.store(1);
+            split.waitingFor.store(0);
+            root.unfinished.fetch_add(1);
+            Push(child);
+            end = middle;
+        }
+        root.invoke(root.context, begin, end);
+    }
+    else if (job.function)
+    {
+        job.function();
+    }
+    Finish(index);
+}
+
+/**
+ * @brief 작업의 남은 몫을 줄이고, 모두 끝났으면 기다리던 작업을 풀어 줍니다.
+ *
+ * 구간 작업이 끝나면 루트의 몫도 줄이므로 루트 핸들은 모든 구간이 끝난
+ * 뒤에야 끝납니다.
+ */
+void JobSystem::Finish(uint32_t index)
+{
+    Job& job = m_Jobs[index];
+    if (job.unfinished.fetch_sub(1) != 1)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(job.mutex);
+        job.finished = true;
+    }
+    // finished 이후로는 dependents 에 추가되지 않음
+    for (uint32_t dependent : job.dependents)
+    {
+        if (m_Jobs[dependent].waitingFor.fetch_sub(1) == 1)
+            Push(dependent);
+    }
+
+    const uint32_t root = job.root;
+    ReleaseJob(index);
+    if (root != index)
+        Finish(root);
+}
+
+void JobSystem::WorkerLoop(uint32_t queueIndex)
+{
+    t_JobSystem = this;
+    t_QueueIndex = queueIndex;
+    CPE2D_PROFILE_THREAD_NAME("JobSystem worker");
+
+    for (;;)
+    {
+        if (TryRunOne(queueIndex))
+            continue;
+
+        bool found = false;
+        for (uint32_t i = 0; i < SpinCount && found == false; ++i)
+        {
+            std::this_thread::yield();
+            found = m_QueuedJobs.load() > 0;
+        }
+        if (found)
+            continue;
+
+        std::unique_lock<std::mutex> lock(m_WakeMutex);
+        m_SleepingWorkers.fetch_add(1);
+        m_WakeCondition.wait(lock,
+                             [&]
+                             {
+                                 return m_Stopping ||
+                                        m_QueuedJobs.load() > 0;
+                             });
+        m_SleepingWorkers.fetch_sub(1);
+        if (m_Stopping)
+            return;
+    }
+}
+
+} // namespace CitadelPhysicsEngine2D
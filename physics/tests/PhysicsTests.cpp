@@ -0,0 +1,1621 @@
+#include <CitadelPhysicsEngine2D/core.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>  // assert 매크로 사용
+#include <cmath>
+#include <cstdint>
+#include <iostream> // 테스트 메시지 출력용
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace CitadelPhysicsEngine2D
+{
+
+namespace
+{
+
+// 테스트 데이터 생성용 결정적 난수 (xorshift32)
+float RandomFloat(uint32_t& state, float lo, float hi)
+{
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return lo + (hi - lo) * static_cast<float>(state & 0xFFFFFF) / 16777216.0f;
+}
+
+AABB RandomAABB(uint32_t& state, float worldSize, float maxExtent)
+{
+    glm::vec2 min(RandomFloat(state, 0.0f, worldSize),
+                  RandomFloat(state, 0.0f, worldSize));
+    glm::vec2 size(RandomFloat(state, 0.0f, maxExtent),
+                   RandomFloat(state, 0.0f, maxExtent));
+    return AABB(min, min + size);
+}
+
+OBB RandomOBB(uint32_t& state)
+{
+    glm::vec2 center(RandomFloat(state, 0.0f, 4.0f),
+                     RandomFloat(state, 0.0f, 4.0f));
+    glm::vec2 halfExtents(RandomFloat(state, 0.2f, 1.0f),
+                          RandomFloat(state, 0.2f, 1.0f));
+    return OBB(center, halfExtents, RandomFloat(state, 0.0f, 3.0f));
+}
+
+// 모든 쌍을 검사하는 기준 결과 (a < b, 사전순)
+std::vector<OverlapPair> BruteForcePairs(const std::vector<AABB>& boxes,
+                                         const std::vector<bool>& alive)
+{
+    std::vector<OverlapPair> pairs;
+    for (uint32_t a = 0; a < boxes.size(); ++a)
+        for (uint32_t b = a + 1; b < boxes.size(); ++b)
+            if (alive[a] && alive[b] &&
+                AABB::AABBvsAABB(boxes[a], boxes[b]) == false)
+                pairs.push_back({a, b});
+    return pairs;
+}
+
+[[maybe_unused]] bool SamePairs(const std::vector<OverlapPair>& l,
+                                const std::vector<OverlapPair>& r)
+{
+    if (l.size() != r.size())
+        return false;
+    for (size_t i = 0; i < l.size(); ++i)
+        if (l[i].a != r[i].a || l[i].b != r[i].b)
+            return false;
+    return true;
+}
+
+} // namespace
+
+// 테스트 함수 정의
+void RunPhysicsTests()
+{
+    std::cout << "Running Physics Engine tests...\n";
+
+    // --- Circle vs Circle Tests ---
+    std::cout << "  Testing Circle vs Circle...\n";
+
+    // Case 1: 충돌하는 경우
+    Circle c1(1.0f, {0.0f, 0.0f});
+    Circle c2(1.0f, {1.0f, 0.0f}); // 반지름 합 = 2, 거리 = 1
+    assert(Circle::CirclevsCircle(c1, c2) == false);
+    std::cout << "    Test 1 (Intersecting): Passed\n";
+
+    // Case 2: 정확히 접하는 경우
+    Circle c3(1.0f, {0.0f, 0.0f});
+    Circle c4(1.0f, {2.0f, 0.0f});                   // 반지름 합 = 2, 거리 = 2
+    assert(Circle::CirclevsCircle(c3, c4) == false); // 경계 포함 시 false
+    std::cout << "    Test 2 (Touching): Passed\n";
+
+    // Case 3: 충돌하지 않는 경우
+    Circle c5(1.0f, {0.0f, 0.0f});
+    Circle c6(1.0f, {3.0f, 0.0f}); // 반지름 합 = 2, 거리 = 3
+    assert(Circle::CirclevsCircle(c5, c6) == true);
+    std::cout << "    Test 3 (Not Intersecting): Passed\n";
+
+    // --- AABB vs AABB Tests ---
+    std::cout << "  Testing AABB vs AABB...\n";
+
+    // Case 1: 충돌하는 경우 (겹침)
+    AABB box1({0.0f, 0.0f}, {2.0f, 2.0f});
+    AABB box2({1.0f, 1.0f}, {3.0f, 3.0f}); // X, Y 모두 겹침
+    assert(AABB::AABBvsAABB(box1, box2) == false);
+    std::cout << "    Test 1 (Intersecting): Passed\n";
+
+    // Case 2: 정확히 접하는 경우 (X축)
+    AABB box3({0.0f, 0.0f}, {1.0f, 1.0f});
+    AABB box4({1.0f, 0.0f}, {2.0f, 1.0f}); // X축에서 접함
+    assert(AABB::AABBvsAABB(box3, box4) == false);
+    std::cout << "    Test 2 (Touching X): Passed\n";
+
+    // Case 3: 정확히 접하는 경우 (Y축)
+    AABB box5({0.0f, 0.0f}, {1.0f, 1.0f});
+    AABB box6({0.0f, 1.0f}, {1.0f, 2.0f}); // Y축에서 접함
+    assert(AABB::AABBvsAABB(box5, box6) == false);
+    std::cout << "    Test 3 (Touching Y): Passed\n";
+
+    // Case 4: 충돌하지 않는 경우 (X축 분리)
+    AABB box7({0.0f, 0.0f}, {1.0f, 1.0f});
+    AABB box8({2.0f, 0.0f}, {3.0f, 1.0f}); // X축에서 떨어짐
+    assert(AABB::AABBvsAABB(box7, box8) == true);
+    std::cout << "    Test 4 (Not Intersecting X): Passed\n";
+
+    // Case 5: 충돌하지 않는 경우 (Y축 분리)
+    AABB box9({0.0f, 0.0f}, {1.0f, 1.0f});
+    AABB box10({0.0f, 2.0f}, {1.0f, 3.0f}); // Y축에서 떨어짐
+    assert(AABB::AABBvsAABB(box9, box10) == true);
+    std::cout << "    Test 5 (Not Intersecting Y): Passed\n";
+
+    // --- AABBSoA Batch Tests ---
+    std::cout << "  Testing AABBSoA batch overlap...\n";
+    {
+        uint32_t seed = 12345u;
+        AABBSoA soa;
+        std::vector<AABB> boxes;
+        for (int i = 0; i < 203; ++i) // SIMD 폭의 배수가 아닌 크기
+        {
+            boxes.push_back(RandomAABB(seed, 100.0f, 20.0f));
+            soa.Add(boxes.back());
+        }
+        // 경계 접촉 케이스 포함
+        AABB query({40.0f, 40.0f}, {60.0f, 60.0f});
+        soa.Set(7, AABB({60.0f, 10.0f}, {70.0f, 40.0f}));
+        boxes[7] = soa.Get(7);
+
+        std::vector<uint32_t> expected;
+        for (uint32_t i = 0; i < boxes.size(); ++i)
+        {
+            if (AABB::AABBvsAABB(boxes[i], query) == false)
+                expected.push_back(i);
+        }
+
+        const SimdLevel levels[] = {SimdLevel::Scalar, SimdLevel::SSE2,
+                                    SimdLevel::AVX2};
+        for (SimdLevel level : levels)
+        {
+            if (level > MaxSimdLevel())
+                continue;
+
+            std::vector<uint32_t> indices(soa.Size());
+            uint32_t count =
+                soa.QueryOverlapIndices(query, indices.data(), level);
+            indices.resize(count);
+            assert(indices == expected);
+
+            std::vector<uint32_t> mask((soa.Size() + 31) / 32);
+            [[maybe_unused]] const uint32_t maskCount =
+                soa.QueryOverlapMask(query, mask.data(), level);
+            assert(maskCount == count);
+            for ([[maybe_unused]] uint32_t i : expected)
+                assert((mask[i >> 5] >> (i & 31)) & 1u);
+
+            std::vector<OverlapPair> pairs;
+            soa.QuerySelfOverlapPairs(pairs, level);
+            size_t bruteCount = 0;
+            for (uint32_t a = 0; a < boxes.size(); ++a)
+                for (uint32_t b = a + 1; b < boxes.size(); ++b)
+                    bruteCount += AABB::AABBvsAABB(boxes[a], boxes[b]) ? 0 : 1;
+            assert(pairs.size() == bruteCount);
+        }
+        std::cout << "    Batch vs Scalar: Passed\n";
+    }
+
+    // --- CircleSoA Batch Tests ---
+    std::cout << "  Testing CircleSoA batch overlap...\n";
+    {
+        uint32_t seed = 6789u;
+        CircleSoA soa;
+        std::vector<Circle> circles;
+        for (int i = 0; i < 157; ++i)
+        {
+            circles.emplace_back(RandomFloat(seed, 0.5f, 4.0f),
+                                 glm::vec2(RandomFloat(seed, 0.0f, 60.0f),
+                                           RandomFloat(seed, 0.0f, 60.0f)));
+            soa.Add(circles.back());
+        }
+
+        const SimdLevel levels[] = {SimdLevel::Scalar, SimdLevel::SSE2,
+                                    SimdLevel::AVX2};
+        for (SimdLevel level : levels)
+        {
+            if (level > MaxSimdLevel())
+                continue;
+
+            Circle query(5.0f, {30.0f, 30.0f});
+            std::vector<uint32_t> indices(soa.Size());
+            [[maybe_unused]] uint32_t count =
+                soa.QueryOverlapIndices(query, indices.data(), level);
+            uint32_t expected = 0;
+            for (uint32_t i = 0; i < circles.size(); ++i)
+            {
+                if (Circle::CirclevsCircle(query, circles[i]))
+                    continue;
+                assert(expected < count && indices[expected] == i);
+                ++expected;
+            }
+            assert(count == expected);
+
+            std::vector<OverlapPair> pairs(4096);
+            uint32_t pairCount = soa.QueryTileOverlapPairs(
+                0, soa.Size(), 0, soa.Size(), pairs.data(),
+                static_cast<uint32_t>(pairs.size()), level);
+            assert(pairCount <= pairs.size());
+            for (uint32_t i = 0; i < pairCount; ++i)
+            {
+                assert(pairs[i].a < pairs[i].b);
+                assert(Circle::CirclevsCircle(circles[pairs[i].a],
+                                              circles[pairs[i].b]) == false);
+            }
+            size_t bruteCount = 0;
+            for (uint32_t a = 0; a < circles.size(); ++a)
+                for (uint32_t b = a + 1; b < circles.size(); ++b)
+                    bruteCount +=
+                        Circle::CirclevsCircle(circles[a], circles[b]) ? 0 : 1;
+            assert(pairCount == bruteCount);
+        }
+        std::cout << "    Batch vs Scalar: Passed\n";
+    }
+
+    // --- Sweep and Prune Tests ---
+    std::cout << "  Testing SweepAndPrune broadphase...\n";
+    {
+        uint32_t seed = 424242u;
+        SweepAndPrune sap;
+        std::vector<AABB> boxes;
+        for (int i = 0; i < 300; ++i)
+        {
+            if (i % 2 == 0)
+                boxes.push_back(RandomAABB(seed, 200.0f, 12.0f));
+            else
+                boxes.push_back(Circle(RandomFloat(seed, 1.0f, 5.0f),
+                                       {RandomFloat(seed, 0.0f, 200.0f),
+                                        RandomFloat(seed, 0.0f, 200.0f)})
+                                    .GetAABB());
+            [[maybe_unused]] const uint32_t proxy =
+                sap.CreateProxy(boxes.back());
+            assert(proxy == uint32_t(i));
+        }
+        std::vector<bool> alive(boxes.size(), true);
+
+        std::vector<OverlapPair> pairs;
+        sap.UpdatePairs(pairs);
+        assert(SamePairs(pairs, BruteForcePairs(boxes, alive)));
+        std::cout << "    Initial pairs: Passed\n";
+
+        // 작은 이동 후 (삽입 정렬 경로) 와 프록시 제거 후 재검사
+        for (uint32_t frame = 0; frame < 5; ++frame)
+        {
+            for (uint32_t i = 0; i < boxes.size(); ++i)
+            {
+                glm::vec2 d(RandomFloat(seed, -1.0f, 1.0f),
+                            RandomFloat(seed, -1.0f, 1.0f));
+                boxes[i] = AABB(boxes[i].min + d, boxes[i].max + d);
+                sap.MoveProxy(i, boxes[i]);
+            }
+            sap.DestroyProxy(frame * 7);
+            alive[frame * 7] = false;
+
+            sap.UpdatePairs(pairs);
+            assert(SamePairs(pairs, BruteForcePairs(boxes, alive)));
+        }
+        std::cout << "    Incremental update: Passed\n";
+    }
+
+    // --- Dynamic AABB Tree Tests ---
+    std::cout << "  Testing DynamicTree broadphase...\n";
+    {
+        uint32_t seed = 777u;
+        const float margin = 0.5f;
+        DynamicTree tree(margin);
+        std::vector<AABB> boxes;
+        std::vector<uint32_t> proxies;
+        for (uint32_t i = 0; i < 500; ++i)
+        {
+            boxes.push_back(RandomAABB(seed, 300.0f, 8.0f));
+            proxies.push_back(tree.CreateProxy(boxes.back(), i));
+        }
+        assert(tree.Validate());
+        assert(tree.GetHeight() < 30); // 회전 없이 정렬 순서로 쌓이면 수백
+
+        // fat AABB 안의 작은 이동은 트리를 바꾸지 않음
+        AABB nudged(boxes[0].min + glm::vec2(0.1f), boxes[0].max + 0.1f);
+        [[maybe_unused]] const bool reinserted =
+            tree.MoveProxy(proxies[0], nudged);
+        assert(reinserted == false);
+        boxes[0] = nudged;
+
+        std::vector<OverlapPair> pairs;
+        tree.QueryMovedPairs(pairs); // 초기 이동 버퍼 비우기
+
+        // 한 칸씩 밀면서 모두 재삽입
+        for (uint32_t i = 0; i < boxes.size(); ++i)
+        {
+            glm::vec2 d(float(i % 3) - 1.0f, 1.0f);
+            boxes[i] = AABB(boxes[i].min + d, boxes[i].max + d);
+            [[maybe_unused]] const bool moved =
+                tree.MoveProxy(proxies[i], boxes[i], d);
+            assert(moved);
+        }
+        tree.DestroyProxy(proxies[3]);
+        assert(tree.Validate());
+
+        // fat 쌍은 실제 충돌 쌍을 모두 포함해야 함
+        tree.QueryAllPairs(pairs);
+        std::vector<bool> alive(boxes.size(), true);
+        alive[3] = false;
+        for (const OverlapPair& p : BruteForcePairs(boxes, alive))
+        {
+            bool found = false;
+            for (const OverlapPair& q : pairs)
+            {
+                uint32_t a = tree.GetUserData(q.a), b = tree.GetUserData(q.b);
+                found |= (std::min(a, b) == p.a && std::max(a, b) == p.b);
+            }
+            assert(found);
+        }
+
+        std::vector<OverlapPair> movedPairs;
+        tree.QueryMovedPairs(movedPairs);
+        assert(SamePairs(pairs, movedPairs)); // 모두 이동했으므로 동일
+        std::cout << "    Insert/Move/Remove: Passed\n";
+    }
+
+    // --- Spatial Hash Grid Tests ---
+    std::cout << "  Testing SpatialHashGrid broadphase...\n";
+    {
+        uint32_t seed = 99u;
+        std::vector<Circle> circles;
+        for (int i = 0; i < 400; ++i)
+        {
+            circles.emplace_back(RandomFloat(seed, 0.9f, 1.1f),
+                                 glm::vec2(RandomFloat(seed, -40.0f, 40.0f),
+                                           RandomFloat(seed, -40.0f, 40.0f)));
+        }
+        std::vector<OverlapPair> expected;
+        for (uint32_t a = 0; a < circles.size(); ++a)
+            for (uint32_t b = a + 1; b < circles.size(); ++b)
+                if (Circle::CirclevsCircle(circles[a], circles[b]) == false)
+                    expected.push_back({a, b});
+
+        // 셀 크기가 지름보다 작게 주어져도 결과는 같아야 함
+        const float cellSizes[] = {0.5f, 2.2f, 7.0f};
+        for (float cellSize : cellSizes)
+        {
+            SpatialHashGrid grid(cellSize);
+            std::vector<OverlapPair> pairs;
+            grid.FindPairs(circles.data(),
+                           static_cast<uint32_t>(circles.size()), pairs);
+            assert(SamePairs(pairs, expected));
+        }
+        std::cout << "    Grid vs Brute Force: Passed\n";
+    }
+
+    // --- Parallel Pair Finder Tests ---
+    std::cout << "  Testing ParallelPairFinder...\n";
+    {
+        uint32_t seed = 31337u;
+        AABBSoA boxes;
+        for (int i = 0; i < 1000; ++i)
+            boxes.Add(RandomAABB(seed, 400.0f, 15.0f));
+
+        std::vector<OverlapPair> serial;
+        boxes.QuerySelfOverlapPairs(serial);
+
+        // 스레드 수가 달라도 결과 순서가 같아야 함
+        const uint32_t threadCounts[] = {1, 3, 8};
+        for (uint32_t threadCount : threadCounts)
+        {
+            JobSystem jobs(threadCount);
+            ParallelPairFinder finder(jobs);
+            std::vector<OverlapPair> pairs;
+            finder.FindSelfPairs(boxes, pairs);
+            assert(SamePairs(pairs, serial));
+
+            std::vector<OverlapPair> bipartite, expected;
+            finder.FindPairs(boxes, boxes, bipartite);
+            boxes.QueryOverlapPairs(boxes, expected);
+            assert(SamePairs(bipartite, expected));
+        }
+        std::cout << "    Deterministic merge: Passed\n";
+    }
+
+    // --- Job System Tests ---
+    std::cout << "  Testing job system...\n";
+    {
+        JobSystem jobs(4);
+        assert(jobs.GetThreadCount() == 4);
+
+        // 병렬 for: 모든 인덱스를 정확히 한 번씩, grain 이하 구간으로 실행
+        std::vector<uint32_t> visits(10000, 0);
+        std::atomic<uint32_t> largest{0};
+        jobs.ParallelFor(10000, 64,
+                         [&](uint32_t begin, uint32_t end)
+                         {
+                             uint32_t size = end - begin;
+                             uint32_t seen = largest.load();
+                             while (size > seen &&
+                                    !largest.compare_exchange_weak(seen, size))
+                             {
+                             }
+                             for (uint32_t i = begin; i < end; ++i)
+                                 ++visits[i];
+                         });
+        assert(std::all_of(visits.begin(), visits.end(),
+                           [](uint32_t v) { return v == 1; }));
+        assert(largest.load() <= 64);
+
+        // 의존성: a, b 가 끝난 뒤 c, 작업 안에서 병렬 for 를 기다려도 됨
+        std::atomic<uint32_t> sum{0};
+        uint32_t seenByC = 0;
+        JobHandle a = jobs.Schedule([&] { sum += 1; });
+        JobHandle b = jobs.ScheduleParallelFor(
+            100, 1, [&](uint32_t begin, uint32_t end) { sum += end - begin; });
+        const JobHandle dependencies[] = {a, b};
+        JobHandle c = jobs.Schedule(
+            [&]
+            {
+                seenByC = sum.load();
+                jobs.ParallelFor(1000, 10, [&](uint32_t begin, uint32_t end)
+                                 { sum += end - begin; });
+            },
+            dependencies, 2);
+        jobs.Wait(c);
+        assert(jobs.IsDone(a) && jobs.IsDone(b) && jobs.IsDone(c));
+        assert(seenByC == 101 && sum.load() == 1101);
+
+        // 슬롯 수보다 많은 작업을 예약해도 끝남 (예약하는 스레드가 도움)
+        std::atomic<uint32_t> count{0};
+        JobHandle last;
+        for (uint32_t i = 0; i < JobSystem::MaxJobs * 2; ++i)
+            last = jobs.Schedule([&] { ++count; }, &last, 1);
+        jobs.Wait(last);
+        assert(count.load() == JobSystem::MaxJobs * 2);
+        std::cout << "    Work stealing: Passed\n";
+    }
+
+    // --- Frame Arena Tests ---
+    std::cout << "  Testing frame arena...\n";
+    {
+        StackArena arena(256);
+        [[maybe_unused]] auto* bytes = arena.Allocate<uint8_t>(3);
+        [[maybe_unused]] auto* floats = arena.Allocate<float>(4);
+        assert(reinterpret_cast<uintptr_t>(floats) % alignof(float) == 0);
+        assert(bytes != nullptr && arena.GetUsed() == 4 + 16);
+
+        // 마커로 되돌리면 같은 자리를 다시 씀
+        const size_t marker = arena.GetMarker();
+        [[maybe_unused]] void* first = arena.Allocate(64, 64);
+        arena.FreeToMarker(marker);
+        [[maybe_unused]] void* again = arena.Allocate(64, 64);
+        assert(again == first);
+        assert(reinterpret_cast<uintptr_t>(first) % 64 == 0);
+
+        // 넘치면 전역 할당자에서 받고, Reset 때 버퍼를 키워 다음엔 안 넘침
+        arena.Reset();
+        for (int round = 0; round < 2; ++round)
+        {
+            for (int i = 0; i < 8; ++i)
+                arena.Allocate<float>(32);
+            arena.Reset();
+        }
+        assert(arena.GetOverflowCount() > 0);
+        assert(arena.GetCapacity() >= arena.GetHighWaterMark());
+        [[maybe_unused]] const uint32_t overflows = arena.GetOverflowCount();
+        for (int i = 0; i < 8; ++i)
+            arena.Allocate<float>(32);
+        arena.Reset();
+        assert(arena.GetOverflowCount() == overflows);
+        std::cout << "    Stack arena: Passed\n";
+
+        // 병렬 쌍 찾기도 같은 접촉을 만들고, 정상 상태에서는 arena 가
+        // 넘치지 않음
+        auto build = [](World& world)
+        {
+            BodyDef ground;
+            ground.type = BodyType::Static;
+            ground.shape = ShapeType::Box;
+            ground.position = {0.0f, -0.5f};
+            ground.halfExtents = {50.0f, 0.5f};
+            world.CreateBody(ground);
+
+            BodyDef box;
+            box.shape = ShapeType::Box;
+            for (int row = 0; row < 12; ++row)
+            {
+                for (int i = 0; i < 12 - row; ++i)
+                {
+                    box.position = {(i - (12 - row) * 0.5f) * 1.05f,
+                                    0.5f + row * 1.0f};
+                    world.CreateBody(box);
+                }
+            }
+        };
+        JobSystem jobs(4);
+        World serial({0.0f, -10.0f});
+        World parallel({0.0f, -10.0f});
+        parallel.SetJobSystem(&jobs);
+        build(serial);
+        build(parallel);
+
+        [[maybe_unused]] uint32_t warmOverflows = 0;
+        for (int i = 0; i < 240; ++i)
+        {
+            serial.Step(1.0f / 60.0f);
+            parallel.Step(1.0f / 60.0f);
+            if (i == 180)
+                warmOverflows = parallel.GetFrameArena().GetOverflowCount();
+
+            const auto& expected = serial.GetContacts();
+            [[maybe_unused]] const auto& contacts = parallel.GetContacts();
+            assert(expected.size() == contacts.size());
+            for (size_t c = 0; c < expected.size(); ++c)
+                assert(expected[c].a == contacts[c].a &&
+                       expected[c].b == contacts[c].b);
+        }
+        assert(parallel.GetFrameArena().GetOverflowCount() == warmOverflows);
+        assert(parallel.GetFrameArena().GetHighWaterMark() > 0);
+        std::cout << "    World step scratch: Passed\n";
+    }
+
+    // --- Contact Manifold Tests ---
+    std::cout << "  Testing contact manifolds...\n";
+    {
+        ContactManifold m;
+        assert(CollideCircles(c1, c2, m));
+        assert(m.normal == glm::vec2(1.0f, 0.0f));
+        assert(std::abs(m.penetration - 1.0f) < 1e-6f && m.pointCount == 1);
+        assert(CollideCircles(c5, c6, m) == false);
+        std::cout << "    Circle vs Circle: Passed\n";
+
+        assert(CollideAABBs(box1, box2, m));
+        assert(m.pointCount == 2 && m.penetration == 1.0f);
+        assert(CollideAABBs(box3, box4, m) && m.penetration == 0.0f);
+        assert(m.normal == glm::vec2(1.0f, 0.0f));
+        assert(CollideAABBs(box7, box8, m) == false);
+        std::cout << "    AABB vs AABB: Passed\n";
+
+        AABB ground({-10.0f, -1.0f}, {10.0f, 0.0f});
+        assert(CollideCircleAABB(Circle(1.0f, {0.0f, 0.5f}), ground, m));
+        assert(m.normal == glm::vec2(0.0f, -1.0f));
+        assert(std::abs(m.penetration - 0.5f) < 1e-6f);
+        // 중심이 상자 안에 있는 경우: 윗면으로 밀려나야 함
+        assert(CollideCircleAABB(Circle(0.5f, {0.0f, -0.25f}), ground, m));
+        assert(m.normal == glm::vec2(0.0f, -1.0f));
+        assert(std::abs(m.penetration - 0.75f) < 1e-6f);
+        assert(CollideCircleAABB(Circle(1.0f, {0.0f, 2.0f}), ground, m) ==
+               false);
+        std::cout << "    Circle vs AABB: Passed\n";
+
+        // 배치: 판정은 AABBvsAABB 와 일치하고 충돌 쌍만 압축 기록
+        uint32_t seed = 2024u;
+        AABBSoA boxes;
+        for (int i = 0; i < 200; ++i)
+            boxes.Add(RandomAABB(seed, 100.0f, 10.0f));
+        std::vector<OverlapPair> pairs;
+        for (uint32_t a = 0; a < boxes.Size(); ++a)
+            for (uint32_t b = a + 1; b < boxes.Size(); b += 7)
+                pairs.push_back({a, b});
+        std::vector<ContactManifold> manifolds(pairs.size());
+        [[maybe_unused]] uint32_t count = CollideAABBsBatch(
+            boxes, pairs.data(), static_cast<uint32_t>(pairs.size()),
+            manifolds.data());
+        uint32_t expected = 0;
+        for (const OverlapPair& p : pairs)
+        {
+            if (AABB::AABBvsAABB(boxes.Get(p.a), boxes.Get(p.b)) == false)
+            {
+                assert(manifolds[expected].a == p.a);
+                assert(manifolds[expected].b == p.b);
+                ++expected;
+            }
+        }
+        assert(count == expected);
+        std::cout << "    Batch: Passed\n";
+    }
+
+    // --- SAT Tests ---
+    std::cout << "  Testing SAT narrowphase...\n";
+    {
+        const float quarterPi = float(M_PI) * 0.25f;
+        ContactManifold m;
+        SATCache cache;
+
+        // 45도 회전한 상자가 바닥 상자 위에 꼭짓점으로 살짝 박힘
+        OBB ground({0.0f, -1.0f}, {5.0f, 1.0f}, 0.0f);
+        OBB diamond({0.0f, std::sqrt(2.0f) * 0.5f - 0.1f}, {0.5f, 0.5f},
+                    quarterPi);
+        assert(OBB::OBBvsOBB(ground, diamond) == false);
+        assert(CollideOBBs(ground, diamond, m, &cache));
+        assert(m.pointCount == 1 && std::abs(m.penetration - 0.1f) < 1e-4f);
+        assert(std::abs(m.normal.y - 1.0f) < 1e-5f);
+        std::cout << "    Rotated box contact: Passed\n";
+
+        // 분리 → 캐시된 축으로 판정
+        diamond.center.y += 1.0f;
+        assert(CollideOBBs(ground, diamond, m, &cache) == false);
+        assert(cache.valid && cache.onB == 0 && cache.edge == 2);
+        assert(CollideOBBs(ground, diamond, m, &cache) == false);
+        std::cout << "    Cached separating axis: Passed\n";
+
+        // 회전 없는 상자는 CollideAABBs 와 같은 깊이/법선
+        OBB boxA({1.0f, 1.0f}, {1.0f, 1.0f}, 0.0f);
+        OBB boxB({2.5f, 1.5f}, {1.0f, 1.0f}, 0.0f);
+        ContactManifold aabbManifold;
+        assert(CollideAABBs(boxA.GetAABB(), boxB.GetAABB(), aabbManifold));
+        assert(CollideOBBs(boxA, boxB, m));
+        assert(m.normal == aabbManifold.normal && m.pointCount == 2);
+        assert(std::abs(m.penetration - aabbManifold.penetration) < 1e-5f);
+
+        // 무작위 OBB 쌍에서 판정이 OBBvsOBB 와 일치
+        uint32_t seed = 55u;
+        for (int i = 0; i < 500; ++i)
+        {
+            [[maybe_unused]] OBB a = RandomOBB(seed);
+            [[maybe_unused]] OBB b = RandomOBB(seed);
+            assert(CollideOBBs(a, b, m) != OBB::OBBvsOBB(a, b));
+        }
+        std::cout << "    OBB vs OBB: Passed\n";
+    }
+
+    // --- GJK/EPA Tests ---
+    std::cout << "  Testing GJK/EPA...\n";
+    {
+        ContactManifold m, expected;
+
+        // 원-원: 전용 함수와 같은 법선/깊이
+        [[maybe_unused]] ConvexProxy pc1 = ConvexProxy::FromCircle(c1);
+        [[maybe_unused]] ConvexProxy pc2 = ConvexProxy::FromCircle(c2);
+        assert(GJKCollide(pc1, pc2, m) && CollideCircles(c1, c2, expected));
+        assert(glm::length(m.normal - expected.normal) < 1e-5f);
+        assert(std::abs(m.penetration - expected.penetration) < 1e-5f);
+        assert(GJKOverlap(ConvexProxy::FromCircle(c5),
+                          ConvexProxy::FromCircle(c6)) == false);
+
+        // AABB-AABB: EPA 깊이가 CollideAABBs 와 같음
+        AABB a({0.0f, 0.0f}, {2.0f, 2.0f});
+        AABB b({1.5f, 0.5f}, {3.5f, 2.5f});
+        assert(CollideAABBs(a, b, expected));
+        assert(GJKCollide(ConvexProxy::FromAABB(a), ConvexProxy::FromAABB(b),
+                          m));
+        assert(glm::length(m.normal - expected.normal) < 1e-4f);
+        assert(std::abs(m.penetration - expected.penetration) < 1e-4f);
+        std::cout << "    Penetration vs analytic: Passed\n";
+
+        // 원-AABB: 중심이 상자 안에 있는 경우 (core 겹침 → EPA)
+        AABB ground({-10.0f, -1.0f}, {10.0f, 0.0f});
+        Circle sunk(0.5f, {0.0f, -0.25f});
+        assert(CollideCircleAABB(sunk, ground, expected));
+        assert(GJKCollide(ConvexProxy::FromCircle(sunk),
+                          ConvexProxy::FromAABB(ground), m));
+        assert(glm::length(m.normal - expected.normal) < 1e-4f);
+        assert(std::abs(m.penetration - expected.penetration) < 1e-4f);
+
+        // 거리: 떨어진 원과 회전 상자
+        OBB diamond({0.0f, 0.0f}, {1.0f, 1.0f}, float(M_PI) * 0.25f);
+        Circle probe(0.5f, {3.0f, 0.0f});
+        SimplexCache cache;
+        DistanceOutput out = GJKDistance(ConvexProxy::FromOBB(diamond),
+                                         ConvexProxy::FromCircle(probe),
+                                         &cache);
+        [[maybe_unused]] float expectedDist = 3.0f - std::sqrt(2.0f) - 0.5f;
+        assert(std::abs(out.distance - expectedDist) < 1e-4f);
+        std::cout << "    Distance: Passed\n";
+
+        // warm start: 조금 움직인 뒤에는 1~2 회 반복으로 수렴
+        probe.position.y += 0.05f;
+        out = GJKDistance(ConvexProxy::FromOBB(diamond),
+                          ConvexProxy::FromCircle(probe), &cache);
+        assert(out.iterations <= 2);
+        std::cout << "    Warm start: Passed\n";
+    }
+
+    // --- CCD Tests ---
+    std::cout << "  Testing continuous collision...\n";
+    {
+        // 얇은 벽을 한 스텝에 통과하는 총알: 끝 위치 검사로는 놓침
+        AABB wall({4.9f, -5.0f}, {5.1f, 5.0f});
+        Circle bullet(0.1f, {0.0f, 0.0f});
+        glm::vec2 move(10.0f, 0.0f);
+        assert(AABB::AABBvsAABB(Circle(0.1f, move).GetAABB(), wall));
+
+        TOIResult toi;
+        assert(TimeOfImpactCircleAABB(bullet, move, wall, toi));
+        assert(std::abs(toi.t - 0.48f) < 1e-5f);
+        assert(toi.normal == glm::vec2(1.0f, 0.0f));
+
+        // 모서리: 꼭짓점 원과의 충돌 / 아슬아슬하게 빗나감
+        AABB box({0.0f, 0.0f}, {1.0f, 1.0f});
+        assert(TimeOfImpactCircleAABB(Circle(0.5f, {-2.0f, 1.3f}),
+                                      {4.0f, 0.0f}, box, toi));
+        assert(std::abs(toi.t - (2.0f - 0.4f) / 4.0f) < 1e-5f);
+        assert(TimeOfImpactCircleAABB(Circle(0.5f, {-2.0f, 1.2f}),
+                                      {4.0f, -4.0f}, box, toi) == false);
+
+        // 원-원: 마주 보고 이동
+        assert(TimeOfImpactCircles(Circle(0.5f, {0.0f, 0.0f}), {4.0f, 0.0f},
+                                   Circle(0.5f, {6.0f, 0.0f}), {-4.0f, 0.0f},
+                                   toi));
+        assert(std::abs(toi.t - 0.625f) < 1e-5f);
+        assert(toi.normal == glm::vec2(1.0f, 0.0f));
+        assert(TimeOfImpactCircles(c1, {0.0f, 0.0f}, c2, {0.0f, 0.0f}, toi) &&
+               toi.t == 0.0f);
+        std::cout << "    Time of impact: Passed\n";
+
+        // CCD 단계: 빠르거나 bullet 인 원만 검사
+        CircleSoA circles;
+        circles.Add(bullet);                          // 빠름 → 벽
+        circles.Add(Circle(0.5f, {0.0f, 3.0f}));      // 느림 → 제외
+        circles.Add(Circle(0.1f, {0.0f, -3.0f}));     // bullet, 벽 앞에 멈춤
+        AABBSoA walls;
+        walls.Add(wall);
+        glm::vec2 moves[3] = {move, {0.1f, 0.0f}, {4.0f, 0.0f}};
+        uint8_t bullets[3] = {0, 0, 1};
+
+        std::vector<TOIEvent> events;
+        [[maybe_unused]] uint32_t found =
+            FindTimeOfImpacts(circles, moves, bullets, walls, CCDSettings(),
+                              events);
+        assert(found == 1 && events.size() == 1);
+        assert(events[0].circle == 0 && events[0].otherIsBox &&
+               events[0].other == 0);
+
+        moves[2] = {10.0f, 0.0f};
+        events.clear();
+        found = FindTimeOfImpacts(circles, moves, bullets, walls,
+                                  CCDSettings(), events);
+        assert(found == 2);
+        assert(events[1].circle == 2 && events[1].otherIsBox);
+        std::cout << "    CCD stage: Passed\n";
+    }
+
+    // --- World Tests ---
+    std::cout << "  Testing world...\n";
+    {
+        World world({0.0f, -10.0f});
+        world.SetSleepingEnabled(false); // 잠들면 접촉 목록이 비므로
+
+        BodyDef groundDef;
+        groundDef.type = BodyType::Static;
+        groundDef.shape = ShapeType::Box;
+        groundDef.position = {0.0f, -0.5f};
+        groundDef.halfExtents = {10.0f, 0.5f};
+        [[maybe_unused]] BodyHandle ground = world.CreateBody(groundDef);
+
+        BodyDef ballDef;
+        ballDef.position = {0.0f, 2.0f};
+        ballDef.radius = 0.5f;
+        BodyHandle ball = world.CreateBody(ballDef);
+
+        BodyDef boxDef;
+        boxDef.shape = ShapeType::Box;
+        boxDef.position = {3.0f, 1.0f};
+        boxDef.angle = 0.3f;
+        [[maybe_unused]] BodyHandle box = world.CreateBody(boxDef);
+
+        for (int i = 0; i < 180; ++i)
+            world.Step(1.0f / 60.0f);
+
+        // 바닥 위에 정지 (정적 body 는 움직이지 않음)
+        assert(world.GetPosition(ground) == glm::vec2(0.0f, -0.5f));
+        assert(std::abs(world.GetPosition(ball).y - 0.5f) < 0.05f);
+        assert(glm::length(world.GetLinearVelocity(ball)) < 0.1f);
+        assert(std::abs(world.GetPosition(box).y - 0.5f) < 0.05f);
+        assert(world.GetContacts().size() == 2);
+        std::cout << "    Resting contact: Passed\n";
+
+        // 단계별 시간은 겹치지 않는 구간이라 전체 스텝 시간을 넘지 않음
+        [[maybe_unused]] const StepProfile& profile = world.GetProfile();
+        assert(profile.step > 0.0f);
+        assert(profile.collide >= 0.0f && profile.collide <= profile.step);
+        assert(profile.solveVelocities <= profile.step);
+        assert(profile.integrateVelocities + profile.broadphase +
+                   profile.collide + profile.solveVelocities +
+                   profile.continuous + profile.integratePositions +
+                   profile.solvePositions + profile.sleep <=
+               profile.step * 1.001f);
+        std::cout << "    Step profile: Passed\n";
+
+        // 핸들: 제거 후 무효, 슬롯 재사용 시 세대 증가
+        world.DestroyBody(ball);
+        assert(world.IsValid(ball) == false && world.GetBodyCount() == 2);
+        [[maybe_unused]] BodyHandle reused = world.CreateBody(ballDef);
+        assert(reused.index == ball.index && reused != ball);
+        assert(world.IsValid(reused));
+        std::cout << "    Handles: Passed\n";
+
+        // bullet 은 얇은 벽을 뚫지 않음
+        World space({0.0f, 0.0f});
+        BodyDef wallDef;
+        wallDef.type = BodyType::Static;
+        wallDef.shape = ShapeType::Box;
+        wallDef.position = {5.0f, 0.0f};
+        wallDef.halfExtents = {0.05f, 5.0f};
+        space.CreateBody(wallDef);
+
+        BodyDef bulletDef;
+        bulletDef.radius = 0.05f;
+        bulletDef.linearVelocity = {600.0f, 0.0f};
+        bulletDef.bullet = true;
+        [[maybe_unused]] BodyHandle bullet = space.CreateBody(bulletDef);
+        for (int i = 0; i < 10; ++i)
+            space.Step(1.0f / 60.0f);
+        assert(space.GetPosition(bullet).x < 5.0f);
+        std::cout << "    Bullet: Passed\n";
+
+        // 비스듬히 부딪힌 bullet 은 남은 시간만큼만 벽을 따라 미끄러짐
+        // 충돌 시점 t = 0.49 에 (4.9, 4.9), 남은 0.51 * 10 만큼 y 로 이동
+        World slide({0.0f, 0.0f});
+        wallDef.halfExtents = {0.05f, 50.0f};
+        slide.CreateBody(wallDef);
+        bulletDef.linearVelocity = {600.0f, 600.0f};
+        BodyHandle glancing = slide.CreateBody(bulletDef);
+        slide.Step(1.0f / 60.0f);
+        [[maybe_unused]] const glm::vec2 slid = slide.GetPosition(glancing);
+        assert(std::abs(slid.x - 4.9f) < 1.0e-3f);
+        assert(std::abs(slid.y - 10.0f) < 1.0e-2f);
+        assert(slide.GetLinearVelocity(glancing).x == 0.0f);
+        std::cout << "    Bullet slide: Passed\n";
+    }
+    {
+        // 핸들 풀: 제거하면 마지막 항목이 빈자리로 옮겨지고 id 는 재사용
+        HandlePool<BodyHandle> pool;
+        BodyHandle a = pool.Create();
+        [[maybe_unused]] BodyHandle b = pool.Create();
+        [[maybe_unused]] BodyHandle c = pool.Create();
+        [[maybe_unused]] const uint32_t filled = pool.Destroy(a);
+        assert(filled == 0 && pool.GetSize() == 2);
+        assert(pool.GetDenseIndex(c) == 0 && pool.GetHandle(0) == c);
+        assert(pool.GetDenseIndex(b) == 1 && pool.IsValid(a) == false);
+        [[maybe_unused]] BodyHandle d = pool.Create();
+        assert(d.index == a.index && d.generation == a.generation + 1);
+        assert(pool.GetDenseIndex(d) == 2 && pool.GetIdCount() == 3);
+        pool.Swap(0, 2);
+        assert(pool.GetHandle(0) == d && pool.GetDenseIndex(c) == 2);
+
+        // 잠든 island 의 body 가 옮겨져도 island 와 핸들이 유지됨
+        World world({0.0f, -10.0f});
+        BodyDef ballDef;
+        ballDef.position = {8.0f, 0.5f};
+        BodyHandle ball = world.CreateBody(ballDef);
+
+        BodyDef groundDef;
+        groundDef.type = BodyType::Static;
+        groundDef.shape = ShapeType::Box;
+        groundDef.position = {0.0f, -0.5f};
+        groundDef.halfExtents = {10.0f, 0.5f};
+        world.CreateBody(groundDef);
+
+        BodyDef boxDef;
+        boxDef.shape = ShapeType::Box;
+        std::vector<BodyHandle> stack;
+        for (int i = 0; i < 3; ++i)
+        {
+            boxDef.position = {0.0f, 0.5f + float(i)};
+            stack.push_back(world.CreateBody(boxDef));
+        }
+        for (int i = 0; i < 180; ++i)
+            world.Step(1.0f / 60.0f);
+        assert(world.GetAwakeBodyCount() == 0);
+
+        // 지운 칸은 마지막 body 가 채움
+        uint32_t ballIndex = 0;
+        while (world.GetBodyHandle(ballIndex) != ball)
+            ++ballIndex;
+        [[maybe_unused]] const BodyHandle last =
+            world.GetBodyHandle(world.GetBodyCount() - 1);
+        [[maybe_unused]] const glm::vec2 top = world.GetPosition(stack[2]);
+        world.DestroyBody(ball);
+        assert(world.GetBodyCount() == 4 &&
+               world.GetBodyHandle(ballIndex) == last);
+        assert(world.GetPosition(stack[2]) == top);
+        world.Step(1.0f / 60.0f);
+        assert(world.GetAwakeBodyCount() == 0);
+        world.WakeBody(stack[0]);
+        assert(world.IsAwake(stack[2]) && world.GetAwakeBodyCount() == 3);
+
+        // 매 스텝 발사체를 만들고 오래된 것부터 지워도 핸들과 접촉이 유지됨
+        std::vector<BodyHandle> projectiles;
+        BodyDef projectileDef;
+        projectileDef.radius = 0.1f;
+        for (int i = 0; i < 300; ++i)
+        {
+            projectileDef.position = {-8.0f + 0.4f * float(i % 41), 4.0f};
+            projectiles.push_back(world.CreateBody(projectileDef));
+            if (projectiles.size() > 40)
+            {
+                world.DestroyBody(projectiles.front());
+                projectiles.erase(projectiles.begin());
+            }
+            world.Step(1.0f / 60.0f);
+            for ([[maybe_unused]] const ContactManifold& contact :
+                 world.GetContacts())
+                assert(contact.a < contact.b &&
+                       contact.b < world.GetBodyCount());
+        }
+        assert(world.GetBodyCount() == 4 + 40);
+        for ([[maybe_unused]] BodyHandle handle : projectiles)
+            assert(world.IsValid(handle) &&
+                   world.GetPosition(handle).y < 4.0f);
+        for ([[maybe_unused]] BodyHandle handle : stack)
+            assert(std::abs(world.GetPosition(handle).x) < 1.0f);
+        std::cout << "    Handle pool: Passed\n";
+    }
+    {
+        // 멈춘 상자 더미는 island 단위로 잠들고, 닿거나 WakeBody 로 깨어남
+        World world({0.0f, -10.0f});
+
+        BodyDef groundDef;
+        groundDef.type = BodyType::Static;
+        groundDef.shape = ShapeType::Box;
+        groundDef.position = {0.0f, -0.5f};
+        groundDef.halfExtents = {10.0f, 0.5f};
+        [[maybe_unused]] BodyHandle ground = world.CreateBody(groundDef);
+        assert(world.IsAwake(ground) == false);
+
+        BodyDef boxDef;
+        boxDef.shape = ShapeType::Box;
+        std::vector<BodyHandle> stack;
+        for (int i = 0; i < 3; ++i)
+        {
+            boxDef.position = {0.0f, 0.5f + float(i)};
+            stack.push_back(world.CreateBody(boxDef));
+        }
+        BodyDef ballDef;
+        ballDef.position = {6.0f, 0.5f};
+        [[maybe_unused]] BodyHandle far = world.CreateBody(ballDef);
+
+        for (int i = 0; i < 180; ++i)
+            world.Step(1.0f / 60.0f);
+        assert(world.GetAwakeBodyCount() == 0);
+        assert(world.GetContacts().empty());
+        [[maybe_unused]] const glm::vec2 top = world.GetPosition(stack[2]);
+
+        // 잠든 동안에는 적분되지 않음
+        world.Step(1.0f / 60.0f);
+        assert(world.GetPosition(stack[2]) == top);
+
+        // 떨어지는 공이 닿으면 더미 전체가 깨어나고 다시 잠듦
+        ballDef.position = {0.0f, 4.0f};
+        [[maybe_unused]] BodyHandle ball = world.CreateBody(ballDef);
+        bool woke = false;
+        for (int i = 0; i < 60 && woke == false; ++i)
+        {
+            world.Step(1.0f / 60.0f);
+            woke = world.IsAwake(stack[0]);
+        }
+        assert(woke && world.IsAwake(stack[1]) && world.IsAwake(ball));
+        assert(world.IsAwake(far) == false);
+
+        for (int i = 0; i < 240; ++i)
+            world.Step(1.0f / 60.0f);
+        assert(world.GetAwakeBodyCount() == 0);
+        assert(std::abs(world.GetPosition(ball).y - 3.5f) < 0.05f);
+
+        // 명시적으로 깨우면 접촉으로 이어진 island 만 깨어남
+        world.WakeBody(stack[0]);
+        assert(world.GetAwakeBodyCount() == 4);
+        assert(world.IsAwake(ball) && world.IsAwake(far) == false);
+
+        // island 안의 body 를 제거하면 나머지가 깨어남
+        for (int i = 0; i < 120; ++i)
+            world.Step(1.0f / 60.0f);
+        assert(world.IsAwake(stack[2]) == false);
+        world.DestroyBody(stack[0]);
+        assert(world.IsAwake(stack[2]) && world.GetAwakeBodyCount() == 3);
+        std::cout << "    Sleeping islands: Passed\n";
+    }
+
+    // --- Contact Solver Tests ---
+    std::cout << "  Testing contact solver...\n";
+    {
+        // 상자 10 개 쌓기: warm start 로 4 회 반복에서도 무너지지 않음
+        World world({0.0f, -10.0f});
+        world.SetVelocityIterations(4);
+        world.SetSleepingEnabled(false); // 마지막 스텝의 충격량 확인용
+
+        BodyDef groundDef;
+        groundDef.type = BodyType::Static;
+        groundDef.shape = ShapeType::Box;
+        groundDef.position = {0.0f, -0.5f};
+        groundDef.halfExtents = {20.0f, 0.5f};
+        world.CreateBody(groundDef);
+
+        BodyDef boxDef;
+        boxDef.shape = ShapeType::Box;
+        boxDef.halfExtents = {0.5f, 0.5f};
+        boxDef.friction = 0.6f;
+        std::vector<BodyHandle> stack;
+        for (int i = 0; i < 10; ++i)
+        {
+            boxDef.position = {0.0f, 0.5f + 1.0f * float(i)};
+            stack.push_back(world.CreateBody(boxDef));
+        }
+
+        for (int i = 0; i < 300; ++i)
+            world.Step(1.0f / 60.0f);
+
+        for (int i = 0; i < 10; ++i)
+        {
+            [[maybe_unused]] glm::vec2 p = world.GetPosition(stack[i]);
+            assert(std::abs(p.x) < 0.01f);
+            assert(std::abs(p.y - (0.5f + float(i))) < 0.05f);
+        }
+
+        // 맨 위 상자: 누적 법선 충격량의 합이 m * g * dt 에 수렴
+        const ContactConstraint& top =
+            world.GetContactSolver().GetConstraints().back();
+        float total = 0.0f;
+        for (uint32_t k = 0; k < top.pointCount; ++k)
+            total += top.points[k].normalImpulse;
+        assert(std::abs(total - 10.0f / 60.0f) < 0.01f);
+
+        // 닿아 있는 상자 쌍은 다음 스텝 SAT 가 이어 쓸 축이 캐시에 남음
+        [[maybe_unused]] uint32_t cachedAxes = 0;
+        for (const ContactManifold& contact : world.GetContacts())
+        {
+            const uint32_t idA = world.GetBodyHandle(contact.a).index;
+            const uint32_t idB = world.GetBodyHandle(contact.b).index;
+            const CachedContact* entry = world.GetContactCache().Find(
+                ContactCache::MakeKey(std::min(idA, idB), std::max(idA, idB)));
+            if (entry != nullptr && entry->sat.valid != 0)
+                ++cachedAxes;
+        }
+        assert(cachedAxes == world.GetContacts().size() && cachedAxes == 10);
+        std::cout << "    Box stack: Passed\n";
+    }
+    {
+        // fat AABB 만 겹치고 닿지 않는 쌍도 분리축만 담은 항목을 캐시에 두고,
+        // broadphase 쌍이 아니게 되면 이벤트 없이 지움
+        World world({0.0f, 0.0f});
+        BodyDef groundDef;
+        groundDef.type = BodyType::Static;
+        groundDef.shape = ShapeType::Box;
+        groundDef.position = {0.0f, -0.5f};
+        groundDef.halfExtents = {5.0f, 0.5f};
+        BodyHandle ground = world.CreateBody(groundDef);
+
+        BodyDef boxDef;
+        boxDef.shape = ShapeType::Box;
+        boxDef.halfExtents = {0.5f, 0.5f};
+        boxDef.position = {0.0f, 0.55f};
+        BodyHandle box = world.CreateBody(boxDef);
+
+        const uint64_t key =
+            ContactCache::MakeKey(std::min(ground.index, box.index),
+                                  std::max(ground.index, box.index));
+        for (int i = 0; i < 3; ++i)
+        {
+            world.Step(1.0f / 60.0f);
+            [[maybe_unused]] const CachedContact* entry =
+                world.GetContactCache().Find(key);
+            assert(world.GetContacts().empty());
+            assert(world.GetContactBeginEvents().empty());
+            assert(entry != nullptr && entry->touching == 0);
+            assert(entry->pointCount == 0 && entry->sat.valid != 0);
+        }
+
+        world.SetLinearVelocity(box, {0.0f, 60.0f});
+        world.Step(1.0f / 60.0f);
+        world.Step(1.0f / 60.0f);
+        assert(world.GetContactCache().Find(key) == nullptr);
+        assert(world.GetContactEndEvents().empty());
+        std::cout << "    Separating axis cache: Passed\n";
+    }
+    {
+        // 색칠 + 병렬 + SIMD 경로는 단일 스레드 스칼라 경로와 비트 단위로 같음
+        auto simulate = [](SimdLevel level, JobSystem* jobs)
+        {
+            World world({0.0f, -10.0f});
+            world.SetVelocityIterations(4);
+            world.GetContactSolver().SetSimdLevel(level);
+            world.SetJobSystem(jobs);
+
+            BodyDef groundDef;
+            groundDef.type = BodyType::Static;
+            groundDef.shape = ShapeType::Box;
+            groundDef.position = {0.0f, -0.5f};
+            groundDef.halfExtents = {40.0f, 0.5f};
+            world.CreateBody(groundDef);
+
+            // 상자 피라미드 + 그 위로 떨어지는 원 (한 점 / 두 점 접촉 혼합)
+            BodyDef def;
+            def.shape = ShapeType::Box;
+            std::vector<BodyHandle> bodies;
+            const int rows = 20;
+            for (int row = 0; row < rows; ++row)
+            {
+                for (int i = 0; i < rows - row; ++i)
+                {
+                    float x = float(i) - 0.5f * float(rows - row);
+                    def.position = {1.05f * x, 0.5f + 1.0f * float(row)};
+                    bodies.push_back(world.CreateBody(def));
+                }
+            }
+            def.shape = ShapeType::Circle;
+            def.radius = 0.3f;
+            for (int i = 0; i < 30; ++i)
+            {
+                def.position = {0.7f * float(i) - 10.0f, 22.0f + 0.1f * i};
+                bodies.push_back(world.CreateBody(def));
+            }
+
+            for (int i = 0; i < 90; ++i)
+                world.Step(1.0f / 60.0f);
+            assert(world.GetContactSolver().GetColorCount() > 1);
+
+            std::vector<float> state;
+            for (BodyHandle handle : bodies)
+            {
+                Transform2D xf = world.GetTransform(handle);
+                glm::vec2 v = world.GetLinearVelocity(handle);
+                state.insert(state.end(), {xf.position.x, xf.position.y,
+                                           world.GetAngle(handle), v.x, v.y});
+            }
+            return state;
+        };
+
+        const std::vector<float> reference =
+            simulate(SimdLevel::Scalar, nullptr);
+        JobSystem jobs(4);
+        const SimdLevel levels[] = {SimdLevel::Scalar, SimdLevel::SSE2,
+                                    SimdLevel::AVX2};
+        for (SimdLevel level : levels)
+        {
+            if (level > MaxSimdLevel())
+                continue;
+            assert(simulate(level, nullptr) == reference);
+            assert(simulate(level, &jobs) == reference);
+        }
+        std::cout << "    Parallel solver determinism: Passed\n";
+    }
+
+    {
+        // lockstep: 스텝마다 상태 해시가 스레드 수 / SIMD 경로와 관계없이
+        // 같고, 한 body 의 위치가 1 ulp 만 달라도 해시가 달라짐
+        auto build = [](World& world, SimdLevel level, JobSystem* jobs)
+        {
+            world.GetContactSolver().SetSimdLevel(level);
+            world.SetJobSystem(jobs);
+            world.SetStateHashEnabled(true);
+
+            BodyDef groundDef;
+            groundDef.type = BodyType::Static;
+            groundDef.shape = ShapeType::Box;
+            groundDef.position = {0.0f, -0.5f};
+            groundDef.halfExtents = {40.0f, 0.5f};
+            world.CreateBody(groundDef);
+
+            BodyDef def;
+            for (int i = 0; i < 200; ++i)
+            {
+                def.shape = i % 3 == 0 ? ShapeType::Circle : ShapeType::Box;
+                def.radius = 0.4f;
+                def.halfExtents = {0.4f, 0.3f};
+                def.position = {0.9f * float(i % 20) - 9.0f,
+                                1.0f + 0.8f * float(i / 20)};
+                def.angle = 0.05f * float(i % 7);
+                world.CreateBody(def);
+            }
+        };
+
+        JobSystem jobs(3);
+        World a({0.0f, -10.0f});
+        World b({0.0f, -10.0f});
+        build(a, SimdLevel::Scalar, nullptr);
+        build(b, MaxSimdLevel(), &jobs);
+        assert(a.ComputeStateHash() == b.ComputeStateHash());
+
+        for (int i = 0; i < 120; ++i)
+        {
+            a.Step(1.0f / 60.0f);
+            b.Step(1.0f / 60.0f);
+            assert(a.GetStateHash() == b.GetStateHash());
+            assert(a.GetStateHash() == a.ComputeStateHash());
+        }
+
+        BodyHandle body{60, 0};
+        assert(b.IsValid(body) && b.IsAwake(body));
+        glm::vec2 p = b.GetPosition(body);
+        p.x = std::nextafter(p.x, 100.0f);
+        b.SetTransform(body, p, b.GetAngle(body));
+        assert(a.ComputeStateHash() != b.ComputeStateHash());
+        a.Step(1.0f / 60.0f);
+        b.Step(1.0f / 60.0f);
+        assert(a.GetStateHash() != b.GetStateHash());
+        std::cout << "    Lockstep state hash: Passed\n";
+
+        // 같은 JobSystem 을 쓰는 두 World 를 서로 다른 스레드에서 Step 해도
+        // 결과가 같음 (각 스레드가 Wait 중에 상대 World 의 작업도 실행)
+        World reference({0.0f, -10.0f});
+        World c({0.0f, -10.0f});
+        World d({0.0f, -10.0f});
+        build(reference, SimdLevel::Scalar, nullptr);
+        build(c, MaxSimdLevel(), &jobs);
+        build(d, MaxSimdLevel(), &jobs);
+        std::thread other(
+            [&d]
+            {
+                for (int i = 0; i < 60; ++i)
+                    d.Step(1.0f / 60.0f);
+            });
+        for (int i = 0; i < 60; ++i)
+        {
+            reference.Step(1.0f / 60.0f);
+            c.Step(1.0f / 60.0f);
+        }
+        other.join();
+        assert(c.GetStateHash() == reference.GetStateHash());
+        assert(d.GetStateHash() == reference.GetStateHash());
+        std::cout << "    Shared job system: Passed\n";
+    }
+
+    {
+        // 롤백: 링에서 복원한 뒤 다시 진행하면 원래 진행과 비트 단위로 같음
+        World world({0.0f, -10.0f});
+        BodyDef groundDef;
+        groundDef.type = BodyType::Static;
+        groundDef.shape = ShapeType::Box;
+        groundDef.position = {0.0f, -0.5f};
+        groundDef.halfExtents = {20.0f, 0.5f};
+        world.CreateBody(groundDef);
+
+        BodyDef def;
+        std::vector<BodyHandle> bodies;
+        for (int i = 0; i < 60; ++i)
+        {
+            def.shape = i % 2 == 0 ? ShapeType::Box : ShapeType::Circle;
+            def.radius = 0.45f;
+            def.halfExtents = {0.45f, 0.45f};
+            def.position = {float(i % 10) - 5.0f, 0.5f + float(i / 10)};
+            bodies.push_back(world.CreateBody(def));
+        }
+        for (int i = 0; i < 30; ++i)
+            world.Step(1.0f / 60.0f);
+
+        WorldSnapshotRing ring(4);
+        [[maybe_unused]] uint64_t hashes[9];
+        for (uint32_t frame = 0; frame < 8; ++frame)
+        {
+            ring.Save(world, frame);
+            hashes[frame] = world.ComputeStateHash();
+            world.Step(1.0f / 60.0f);
+        }
+        hashes[8] = world.ComputeStateHash();
+        assert(ring.Contains(3) == false && ring.Contains(4));
+        [[maybe_unused]] bool restored = ring.Restore(world, 2);
+        assert(restored == false);
+
+        // 저장 이후 body 를 지우고 만들어도 슬롯 / 트리까지 되돌아감
+        world.DestroyBody(bodies[3]);
+        def.position = {0.0f, 8.0f};
+        [[maybe_unused]] BodyHandle extra = world.CreateBody(def);
+        world.Step(1.0f / 60.0f);
+
+        restored = ring.Restore(world, 5);
+        assert(restored);
+        assert(world.ComputeStateHash() == hashes[5]);
+        assert(world.IsValid(bodies[3]) && world.IsValid(extra) == false);
+        for (uint32_t frame = 5; frame < 8; ++frame)
+        {
+            world.Step(1.0f / 60.0f);
+            assert(world.ComputeStateHash() == hashes[frame + 1]);
+        }
+
+        // 같은 스냅샷에 다시 저장하면 크기가 같음 (버퍼 재사용)
+        WorldSnapshot snapshot;
+        world.SaveSnapshot(snapshot);
+        [[maybe_unused]] const size_t size = snapshot.GetSize();
+        world.Step(1.0f / 60.0f);
+        world.SaveSnapshot(snapshot);
+        assert(snapshot.GetSize() == size);
+        std::cout << "    Snapshot rollback: Passed\n";
+    }
+
+    // --- Particle System Tests ---
+    std::cout << "  Testing particle system...\n";
+    {
+        // 로프: 한쪽 끝을 고정한 입자 사슬은 늘어나지 않고 아래로 흔들림
+        ParticleSystem particles({0.0f, -10.0f});
+        particles.SetSubsteps(8);
+        ParticleDef def;
+        def.mass = 0.0f;
+        def.position = {0.0f, 5.0f};
+        uint32_t previous = particles.CreateParticle(def);
+        def.mass = 1.0f;
+        for (int i = 1; i < 20; ++i)
+        {
+            def.position = {0.1f * float(i), 5.0f};
+            uint32_t next = particles.CreateParticle(def);
+            particles.AddDistanceConstraint(previous, next);
+            previous = next;
+        }
+
+        float lowest = 5.0f;
+        for (int i = 0; i < 180; ++i)
+        {
+            particles.Step(1.0f / 60.0f);
+            lowest = std::min(lowest, particles.GetPosition(19).y);
+        }
+
+        assert(particles.GetPosition(0) == glm::vec2(0.0f, 5.0f));
+        for (uint32_t i = 1; i < 20; ++i)
+        {
+            [[maybe_unused]] glm::vec2 d =
+                particles.GetPosition(i) - particles.GetPosition(i - 1);
+            assert(std::abs(glm::length(d) - 0.1f) < 0.005f);
+        }
+        assert(lowest < 3.5f);
+        std::cout << "    Rope: Passed\n";
+    }
+    {
+        // 젤리: 넓이 제약으로 묶인 격자는 바닥에 떨어져도 넓이를 유지하고,
+        // 정적 원 / 상자 밖에 머묾
+        ParticleSystem particles({0.0f, -10.0f});
+        particles.AddCollider(AABB({-10.0f, -1.0f}, {10.0f, 0.0f}));
+        particles.AddCollider(Circle(0.5f, {3.0f, 0.0f}));
+
+        const int n = 6;
+        ParticleDef def;
+        def.radius = 0.05f;
+        for (int y = 0; y < n; ++y)
+        {
+            for (int x = 0; x < n; ++x)
+            {
+                def.position = {-0.5f + 0.2f * float(x),
+                                2.0f + 0.2f * float(y)};
+                particles.CreateParticle(def);
+            }
+        }
+        auto id = [n](int x, int y) { return uint32_t(y * n + x); };
+        for (int y = 0; y < n; ++y)
+        {
+            for (int x = 0; x < n; ++x)
+            {
+                if (x + 1 < n)
+                    particles.AddDistanceConstraint(id(x, y), id(x + 1, y),
+                                                    1e-5f);
+                if (y + 1 < n)
+                    particles.AddDistanceConstraint(id(x, y), id(x, y + 1),
+                                                    1e-5f);
+                if (x + 1 < n && y + 1 < n)
+                {
+                    particles.AddAreaConstraint(id(x, y), id(x + 1, y),
+                                                id(x + 1, y + 1));
+                    particles.AddAreaConstraint(id(x, y), id(x + 1, y + 1),
+                                                id(x, y + 1));
+                }
+            }
+        }
+        // 옆으로 던져 원에도 부딪히게 함
+        for (uint32_t i = 0; i < particles.GetParticleCount(); ++i)
+            particles.SetVelocity(i, {3.0f, 0.0f});
+
+        for (int i = 0; i < 180; ++i)
+            particles.Step(1.0f / 60.0f);
+
+        float area = 0.0f;
+        for (int y = 0; y + 1 < n; ++y)
+        {
+            for (int x = 0; x + 1 < n; ++x)
+            {
+                glm::vec2 a = particles.GetPosition(id(x, y));
+                glm::vec2 b = particles.GetPosition(id(x + 1, y));
+                glm::vec2 c = particles.GetPosition(id(x + 1, y + 1));
+                glm::vec2 d = particles.GetPosition(id(x, y + 1));
+                glm::vec2 ab = b - a, ac = c - a, ad = d - a;
+                area += 0.5f * (ab.x * ac.y - ab.y * ac.x);
+                area += 0.5f * (ac.x * ad.y - ac.y * ad.x);
+            }
+        }
+        assert(std::abs(area - 1.0f) < 0.05f);
+        for (uint32_t i = 0; i < particles.GetParticleCount(); ++i)
+        {
+            [[maybe_unused]] glm::vec2 p = particles.GetPosition(i);
+            assert(p.y > 0.05f - 0.01f);
+            assert(glm::length(p - glm::vec2(3.0f, 0.0f)) > 0.55f - 0.01f);
+        }
+        std::cout << "    Soft body: Passed\n";
+    }
+    {
+        // 입자 충돌: 쏟아부은 입자 더미에서 거의 겹치지 않음.
+        // SIMD 경로는 스칼라 경로와 비트 단위로 같음
+        auto simulate = [](SimdLevel level, bool collide)
+        {
+            ParticleSystem particles({0.0f, -10.0f});
+            particles.SetSimdLevel(level);
+            particles.SetParticleCollisionEnabled(collide);
+            particles.AddCollider(AABB({-2.0f, -1.0f}, {2.0f, 0.0f}));
+            particles.AddCollider(AABB({-3.0f, 0.0f}, {-2.0f, 5.0f}));
+            particles.AddCollider(AABB({2.0f, 0.0f}, {3.0f, 5.0f}));
+            particles.AddCollider(Circle(0.3f, {0.0f, 1.0f}));
+
+            ParticleDef def;
+            def.radius = 0.05f;
+            for (int i = 0; i < 403; ++i)
+            {
+                def.position = {-1.8f + 0.11f * float(i % 33),
+                                1.5f + 0.11f * float(i / 33)};
+                def.velocity = {0.3f * float(i % 5) - 0.6f, 0.0f};
+                particles.CreateParticle(def);
+            }
+            for (int i = 0; i < 120; ++i)
+                particles.Step(1.0f / 60.0f);
+
+            std::vector<float> state;
+            for (uint32_t i = 0; i < particles.GetParticleCount(); ++i)
+            {
+                glm::vec2 p = particles.GetPosition(i);
+                glm::vec2 v = particles.GetVelocity(i);
+                state.insert(state.end(), {p.x, p.y, v.x, v.y});
+            }
+            return state;
+        };
+
+        const std::vector<float> reference = simulate(SimdLevel::Scalar, true);
+        const uint32_t count = uint32_t(reference.size() / 4);
+        float minDistance = 1.0f;
+        for (uint32_t a = 0; a < count; ++a)
+        {
+            glm::vec2 pa(reference[4 * a], reference[4 * a + 1]);
+            assert(pa.y > 0.04f && std::abs(pa.x) < 1.96f);
+            for (uint32_t b = a + 1; b < count; ++b)
+            {
+                glm::vec2 pb(reference[4 * b], reference[4 * b + 1]);
+                minDistance = std::min(minDistance, glm::length(pa - pb));
+            }
+        }
+        assert(minDistance > 0.08f);
+
+        const SimdLevel levels[] = {SimdLevel::SSE2, SimdLevel::AVX2};
+        for (SimdLevel level : levels)
+        {
+            if (level > MaxSimdLevel())
+                continue;
+            assert(simulate(level, true) == reference);
+            assert(simulate(level, false) == simulate(SimdLevel::Scalar,
+                                                      false));
+        }
+        std::cout << "    Particle collision: Passed\n";
+    }
+
+    // --- Contact Cache Tests ---
+    std::cout << "  Testing contact cache...\n";
+    {
+        // 많이 넣고 지워도 (backward shift) 남은 키는 모두 찾을 수 있음
+        ContactCache cache;
+        std::vector<uint64_t> keys;
+        uint32_t seed = 12345u;
+        for (int i = 0; i < 3000; ++i)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            const uint32_t a = (seed >> 8) % 500;
+            keys.push_back(ContactCache::MakeKey(a, a + 1 + i % 7));
+        }
+        std::sort(keys.begin(), keys.end());
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+        for (uint64_t key : keys)
+        {
+            bool inserted = false;
+            cache.Insert(key, inserted).pointCount = 1;
+            assert(inserted);
+        }
+        for (size_t i = 0; i < keys.size(); i += 2)
+        {
+            [[maybe_unused]] const bool found = cache.Remove(keys[i]);
+            assert(found);
+        }
+        assert(cache.GetSize() == keys.size() / 2);
+        for (size_t i = 0; i < keys.size(); ++i)
+        {
+            [[maybe_unused]] const CachedContact* entry = cache.Find(keys[i]);
+            assert((entry != nullptr) == (i % 2 == 1));
+        }
+
+        // 조금씩 정리해도 한 바퀴 돌면 전부 검사됨
+        uint32_t removed = 0;
+        for (uint32_t n = 0; n < cache.GetCapacity(); n += 64)
+            removed += cache.SweepStale(
+                64, [](const CachedContact&) { return true; },
+                [](const CachedContact&) {});
+        assert(removed == keys.size() / 2 && cache.GetSize() == 0);
+        std::cout << "    Open addressing: Passed\n";
+    }
+    {
+        // 공이 바닥에 닿으면 시작, 잠든 동안은 유지, 튀어 오르면 끝 이벤트
+        World world({0.0f, -10.0f});
+        BodyDef groundDef;
+        groundDef.type = BodyType::Static;
+        groundDef.shape = ShapeType::Box;
+        groundDef.position = {0.0f, -0.5f};
+        groundDef.halfExtents = {10.0f, 0.5f};
+        BodyHandle ground = world.CreateBody(groundDef);
+        BodyDef ballDef;
+        ballDef.position = {0.0f, 2.0f};
+        BodyHandle ball = world.CreateBody(ballDef);
+        const uint64_t key = ContactCache::MakeKey(ground.index, ball.index);
+
+        int begins = 0;
+        int ends = 0;
+        auto count = [&]()
+        {
+            for (const OverlapPair& pair : world.GetContactBeginEvents())
+                begins += pair.a == ground.index && pair.b == ball.index;
+            for (const OverlapPair& pair : world.GetContactEndEvents())
+                ends += pair.a == ground.index && pair.b == ball.index;
+        };
+        for (int i = 0; i < 240; ++i)
+        {
+            world.Step(1.0f / 60.0f);
+            count();
+        }
+        assert(world.IsAwake(ball) == false && world.GetContacts().empty());
+        assert(begins == 1 && ends == 0);
+
+        // 잠든 쌍의 충격량이 남아 있어 깨어난 첫 스텝에 warm start 됨
+        [[maybe_unused]] const CachedContact* entry =
+            world.GetContactCache().Find(key);
+        assert(entry != nullptr && entry->pointCount == 1);
+        assert(entry->normalImpulses[0] > 0.0f);
+        world.WakeBody(ball);
+        world.Step(1.0f / 60.0f);
+        count();
+        assert(begins == 1 && ends == 0);
+
+        world.SetLinearVelocity(ball, {0.0f, 5.0f});
+        for (int i = 0; i < 10; ++i)
+        {
+            world.Step(1.0f / 60.0f);
+            count();
+        }
+        assert(begins == 1 && ends == 1);
+        assert(world.GetContactCache().Find(key) == nullptr);
+
+        // 제거된 body 의 쌍은 캐시 정리 단계에서 끝 이벤트와 함께 지워짐
+        for (int i = 0; i < 120; ++i)
+            world.Step(1.0f / 60.0f);
+        assert(world.GetContactCache().Find(key) != nullptr);
+        world.DestroyBody(ball);
+        bool ended = false;
+        for (int i = 0; i < 4 && ended == false; ++i)
+        {
+            world.Step(1.0f / 60.0f);
+            ended = world.GetContactEndEvents().size() == 1;
+        }
+        assert(ended && world.GetContactCache().GetSize() == 0);
+        std::cout << "    Contact events: Passed\n";
+    }
+
+    std::cout << "  Testing profiler...\n";
+    {
+        // 캡처 중에만 기록하고, 작업 스레드의 구역도 함께 내보냄
+        World world;
+        BodyDef def;
+        def.shape = ShapeType::Circle;
+        for (int i = 0; i < 8; ++i)
+        {
+            def.position = {float(i) * 1.5f, 1.0f};
+            world.CreateBody(def);
+        }
+        JobSystem jobs(3);
+        world.SetJobSystem(&jobs);
+
+        world.Step(1.0f / 60.0f); // 캡처 전 구역은 남지 않음
+        Profiler::BeginCapture();
+        {
+            CPE2D_PROFILE_SCOPE("Test::Outer");
+            CPE2D_PROFILE_SCOPE("Test::Inner");
+            world.Step(1.0f / 60.0f);
+        }
+        Profiler::EndCapture();
+        world.Step(1.0f / 60.0f);
+        [[maybe_unused]] const uint32_t eventCount = Profiler::GetEventCount();
+
+        std::ostringstream trace;
+        Profiler::WriteChromeTrace(trace);
+        const std::string json = trace.str();
+        assert(json.find("\"traceEvents\":[") != std::string::npos);
+        assert(json.back() == '\n' && json[json.size() - 2] == '}');
+        assert(Profiler::GetDroppedEventCount() == 0);
+#if defined(CPE2D_PROFILING)
+        assert(eventCount > 3);
+        assert(json.find("\"name\":\"Test::Inner\"") != std::string::npos);
+        assert(json.find("\"name\":\"World::Step\"") != std::string::npos);
+#else
+        assert(eventCount == 0);
+#endif
+        std::cout << "    Chrome trace: Passed\n";
+    }
+
+    // --- 다른 테스트들 추가 가능 ---
+
+    std::cout << "Physics Engine tests finished successfully.\n";
+}
+
+} // namespace CitadelPhysicsEngine2D
+int main()
+{
+    CitadelPhysicsEngine2D::RunPhysicsTests();
+    return 0;
+}
@@ -12,6 +12,10 @@ Application::Application()
 {
     m_Renderer = std::make_unique<Renderer>();
     m_Window = std::make_unique<Window>();
+
+    // 메인 스레드도 Wait 중에 작업을 실행하므로 하드웨어 스레드 수만큼
+    m_JobSystem = std::make_unique<CitadelPhysicsEngine2D::JobSystem>();
+    m_LayerStack.SetJobSystem(m_JobSystem.get());
 }
 
 Application::~Application()
@@ -76,26 +80,139 @@ void Application::Run()
         return;
     }
 
+    CPE2D_PROFILE_THREAD_NAME("Main");
+
+    m_Accumulator = 0.0;
+    double lastTime = glfwGetTime();
     while (m_Running == true && m_Window->ShouldClose() == false)
     {
-        m_Renderer->SetViewport();
+        {
+            CPE2D_PROFILE_SCOPE("Application::Frame");
+            const double now = glfwGetTime();
+            Tick(now - lastTime);
+            lastTime = now;
+
+            // --- Window 업데이트 (이벤트 폴링 + 버퍼 스왑) ---
+            m_Window->OnUpdate();
+        }
+        // 프레임 구역이 닫힌 뒤, 작업 스레드가 모두 쉬는 프레임 사이에 처리
+        UpdateProfileCapture();
+    }
+    FinishProfileCapture();
+}
+
+/**
+ * @brief 다음 프레임부터 frameCount 프레임을 캡처합니다.
+ *
+ * 캡처는 프레임 사이에 시작하고 끝나므로 trace 에는 온전한 프레임만
+ * 들어갑니다. 이미 캡처 중이면 그 캡처를 먼저 파일로 씁니다.
+ */
+void Application::CaptureProfile(uint32_t frameCount, const std::string& path)
+{
+#if !defined(CPE2D_PROFILING)
+    std::cerr << "Profiling is compiled out; configure with "
+                 "-DCPE2D_ENABLE_PROFILING=ON to record zones."
+              << std::endl;
+#endif
+    FinishProfileCapture();
+    if (frameCount == 0)
+        return;
 
-        m_Renderer->BeginFrame();
+    m_ProfileFramesLeft = frameCount;
+    m_ProfilePath = path;
+    CitadelPhysicsEngine2D::Profiler::BeginCapture();
+}
+
+void Application::UpdateProfileCapture()
+{
+    if (m_ProfileFramesLeft == 0)
+        return;
+
+    if (--m_ProfileFramesLeft == 0)
+        FinishProfileCapture();
+}
+
+void Application::FinishProfileCapture()
+{
+    using CitadelPhysicsEngine2D::Profiler;
+
+    if (Profiler::IsCapturing() == false)
+        return;
 
+    Profiler::EndCapture();
+    m_ProfileFramesLeft = 0;
+
+    std::ofstream file(m_ProfilePath);
+    if (file.is_open() == false)
+    {
+        std::cerr << "Failed to open profile output: " << m_ProfilePath
+                  << std::endl;
+        return;
+    }
+    Profiler::WriteChromeTrace(file);
+    std::cout << "Profile written to " << m_ProfilePath << " ("
+              << Profiler::GetEventCount() << " events, "
+              << Profiler::GetDroppedEventCount() << " dropped)" << std::endl;
+}
+
+/**
+ * @brief 한 프레임: 누적된 시간만큼 고정 스텝을 돌리고 보간 비율로 그립니다.
+ *
+ * 한 프레임의 고정 스텝 수를 m_MaxSubSteps 로 제한합니다. 시뮬레이션이
+ * 실시간을 따라가지 못할 때 밀린 시간을 계속 쌓으면 다음 프레임이 더
+ * 느려지는 악순환(spiral of death)이 생기므로, 상한을 넘긴 시간은 버리고
+ * 시뮬레이션이 잠시 느려지는 쪽을 택합니다.
+ *
+ * @param frameTime 지난 프레임 이후 경과 시간 (초)
+ */
+void Application::Tick(double frameTime)
+{
+    CPE2D_PROFILE_SCOPE("Application::Tick");
+
+    // 디버거 정지나 창 이동으로 생긴 큰 간격은 한 번에 따라잡지 않음
+    const double fixedStep = m_FixedTimeStep;
+    frameTime = std::clamp(frameTime, 0.0, fixedStep * m_MaxSubSteps);
+    m_Accumulator += frameTime;
+
+    uint32_t subSteps = 0;
+    while (m_Accumulator >= fixedStep && subSteps < m_MaxSubSteps)
+    {
+        CPE2D_PROFILE_SCOPE("Application::FixedUpdate");
+        // 레이어 이름은 레이어가 살아 있는 동안 유효하고, 캡처는 레이어
+        // 스택을 정리하기 전(Run 끝)에 내보내므로 그대로 구역 이름으로 씀
         for (auto& layer : m_LayerStack)
         {
-            layer->OnUpdate(0.0f);
+            CPE2D_PROFILE_SCOPE(layer->GetName().c_str());
+            layer->OnFixedUpdate(m_FixedTimeStep);
         }
+        m_Accumulator -= fixedStep;
+        ++subSteps;
+    }
+    if (m_Accumulator >= fixedStep)
+        m_Accumulator = std::fmod(m_Accumulator, fixedStep);
+
+    m_Renderer->SetViewport();
+    m_Renderer->BeginFrame();
 
+    {
+        CPE2D_PROFILE_SCOPE("Application::Update");
         for (auto& layer : m_LayerStack)
         {
-            layer->OnRender();
+            CPE2D_PROFILE_SCOPE(layer->GetName().c_str());
+            layer->OnUpdate(static_cast<float>(frameTime));
         }
-        m_Renderer->Render();
+    }
 
-        // --- Window 업데이트 (이벤트 폴링 + 버퍼 스왑) ---
-        m_Window->OnUpdate();
+    const float alpha = static_cast<float>(m_Accumulator / fixedStep);
+    {
+        CPE2D_PROFILE_SCOPE("Application::Render");
+        for (auto& layer : m_LayerStack)
+        {
+            CPE2D_PROFILE_SCOPE(layer->GetName().c_str());
+            layer->OnRender(alpha);
+        }
     }
+    m_Renderer->Render();
 }
 
 void Application::Shutdown()
@@ -2,7 +2,9 @@
 
 #include "layers/LayerStack.h"
 
+#include <cstdint>
 #include <memory>
+#include <string>
 
 namespace Citadel
 {
@@ -27,10 +29,43 @@ public:
     void Run();
     void Shutdown(); // 명시적 호출 가능, 소멸자에서 자동 호출됨
 
+    // 고정 스텝 간격 (초). 기본 1/60
+    void SetFixedTimeStep(float seconds) { m_FixedTimeStep = seconds; }
+    float GetFixedTimeStep() const { return m_FixedTimeStep; }
+    // 프레임당 최대 고정 스텝 수. 넘치는 시간은 버립니다.
+    void SetMaxSubSteps(uint32_t count) { m_MaxSubSteps = count; }
+    uint32_t GetMaxSubSteps() const { return m_MaxSubSteps; }
+
+    // 다음 frameCount 프레임을 프로파일링해 path 에 Chrome trace JSON 으로
+    // 씁니다. CPE2D_ENABLE_PROFILING 빌드에서만 구역이 기록됩니다.
+    void CaptureProfile(uint32_t frameCount, const std::string& path);
+
+    // 레이어와 물리 World 가 함께 쓰는 작업 스케줄러
+    // (World::SetJobSystem 에 넘기면 스레드를 따로 만들지 않음)
+    CitadelPhysicsEngine2D::JobSystem* GetJobSystem() const
+    {
+        return m_JobSystem.get();
+    }
+
+private:
+    void Tick(double frameTime);
+    void UpdateProfileCapture();
+    void FinishProfileCapture();
+
 private:
     bool m_Running = true;
     bool m_Initialized = false;
 
+    // 고정 스텝 누산기
+    float m_FixedTimeStep = 1.0f / 60.0f;
+    uint32_t m_MaxSubSteps = 8;
+    double m_Accumulator = 0.0;
+
+    // 진행 중인 프로파일 캡처 (남은 프레임이 0 이면 없음)
+    uint32_t m_ProfileFramesLeft = 0;
+    std::string m_ProfilePath;
+
+    std::unique_ptr<CitadelPhysicsEngine2D::JobSystem> m_JobSystem;
     LayerStack m_LayerStack;
 
     std::unique_ptr<Window> m_Window;
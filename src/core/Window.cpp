@@ -133,6 +133,7 @@ void Window::OnUpdate()
     if (m_Initialized == false)
         return;
 
+    CPE2D_PROFILE_SCOPE("Window::OnUpdate");
     glfwPollEvents();
     glfwSwapBuffers(m_Window);
 }
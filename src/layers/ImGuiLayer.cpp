@@ -82,7 +82,7 @@ void ImGuiLayer::OnUpdate(float deltaTime)
     ImGui::End();
 }
 
-void ImGuiLayer::OnRender()
+void ImGuiLayer::OnRender(float alpha)
 {
     ImGui::Render();
     ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
@@ -26,7 +26,7 @@ public:
     void OnAttach() override;
     void OnDetach() override;
     void OnUpdate(float deltaTime) override;
-    void OnRender() override;
+    void OnRender(float alpha) override;
 
 private:
     const Window* m_WindowHandle = nullptr;
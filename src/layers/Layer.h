@@ -2,6 +2,11 @@
 
 #include <string>
 
+namespace CitadelPhysicsEngine2D
+{
+class JobSystem;
+}
+
 namespace Citadel
 {
 
@@ -15,14 +20,31 @@ public:
 public:
     virtual void OnAttach() {}
     virtual void OnDetach() {}
+    // 고정 시간 간격 시뮬레이션 (프레임당 0 ~ MaxSubSteps 회 호출)
+    virtual void OnFixedUpdate(float fixedDeltaTime) {}
+    // 프레임당 한 번, 실제 경과 시간으로 호출
     virtual void OnUpdate(float deltaTime) {}
-    virtual void OnRender() {}
+    // alpha: 마지막 고정 스텝 이후 경과 비율 [0, 1)
+    // 이전/현재 고정 스텝 상태를 alpha 로 보간해 그리면 부드럽게 보입니다.
+    virtual void OnRender(float alpha) {}
 
 public:
     const std::string& GetName() const { return m_DebugName; }
 
+    // 앱과 물리 엔진이 함께 쓰는 작업 스케줄러 (LayerStack 이 OnAttach 전에
+    // 설정). 레이어 안의 병렬 작업은 따로 스레드를 만들지 않고 이것을 씁니다.
+    void SetJobSystem(CitadelPhysicsEngine2D::JobSystem* jobs)
+    {
+        m_JobSystem = jobs;
+    }
+    CitadelPhysicsEngine2D::JobSystem* GetJobSystem() const
+    {
+        return m_JobSystem;
+    }
+
 private:
     std::string m_DebugName;
+    CitadelPhysicsEngine2D::JobSystem* m_JobSystem = nullptr;
 };
 
 } // namespace Citadel
\ No newline at end of file
@@ -34,6 +34,7 @@ void LayerStack::Clear()
 
 void LayerStack::PushLayer(std::unique_ptr<Layer> layer)
 {
+    layer->SetJobSystem(m_JobSystem);
     auto it = m_Layers.emplace(m_Layers.begin() + m_LayerInsertIndex,
                                std::move(layer));
     m_LayerInsertIndex++;
@@ -42,6 +43,7 @@ void LayerStack::PushLayer(std::unique_ptr<Layer> layer)
 
 void LayerStack::PushOverlay(std::unique_ptr<Layer> overlay)
 {
+    overlay->SetJobSystem(m_JobSystem);
     m_Layers.emplace_back(std::move(overlay));
     m_Layers.back()->OnAttach();
 }
@@ -79,4 +81,13 @@ void LayerStack::PopOverlay(Layer* overlay)
 
 bool LayerStack::ValidateLayers() { return true; }
 
+void LayerStack::SetJobSystem(CitadelPhysicsEngine2D::JobSystem* jobs)
+{
+    m_JobSystem = jobs;
+    for (auto& layer : m_Layers)
+    {
+        layer->SetJobSystem(jobs);
+    }
+}
+
 } // namespace Citadel
@@ -24,6 +24,9 @@ public:
 public:
     bool ValidateLayers();
 
+    // 이미 있는 레이어와 이후 추가되는 레이어에 작업 스케줄러를 설정
+    void SetJobSystem(CitadelPhysicsEngine2D::JobSystem* jobs);
+
     // 반복자 제공 (Application의 Run 루프에서 사용)
     std::vector<std::unique_ptr<Layer>>::iterator begin()
     {
@@ -48,6 +51,8 @@ private:
     // [0, m_LayerInsertIndex) : layer
     // [m_LayerInsertIndex, m_Layers.size()) : overlay
     uint32_t m_LayerInsertIndex = 0;
+
+    CitadelPhysicsEngine2D::JobSystem* m_JobSystem = nullptr;
 };
 
 } // namespace Citadel
@@ -2,17 +2,24 @@
 
 #include "core/Application.h"
 
-namespace CitadelPhysicsEngine2D
-{
-void RunPhysicsTests();
-}
-
 int main(int argc, char** argv)
 {
-    CitadelPhysicsEngine2D::RunPhysicsTests();
-
     Citadel::Application app;
 
+    // --profile <frames> [path]: 처음 frames 프레임을 Chrome trace 로 저장
+    for (int i = 1; i + 1 < argc; ++i)
+    {
+        if (std::string(argv[i]) != "--profile")
+            continue;
+
+        const uint32_t frames =
+            static_cast<uint32_t>(std::strtoul(argv[i + 1], nullptr, 10));
+        const bool hasPath = i + 2 < argc && argv[i + 2][0] != '-';
+        app.CaptureProfile(frames,
+                           hasPath ? argv[i + 2] : "citadel_trace.json");
+        break;
+    }
+
     try
     {
         if (app.Init())
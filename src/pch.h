@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <cmath>
 #include <filesystem> // std::filesystem::current_path() C++17 이상
 #include <fstream>
 #include <iostream>
@@ -55,6 +55,7 @@ void Renderer::BeginFrame()
 
 void Renderer::Render()
 {
+    CPE2D_PROFILE_SCOPE("Renderer::Render");
     // using transform ver
     m_ShapeRenderer.Draw(m_Mesh, m_Transform, m_Color);
     m_ShapeRenderer.Draw(m_Rect, m_RectTransform, m_RectColor);